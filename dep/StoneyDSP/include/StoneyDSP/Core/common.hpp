@@ -63,6 +63,10 @@
  #include <simde/x86/sse4.2.h>
 #endif
 
+#if STONEYDSP_USING_AVX
+ #include <immintrin.h>
+#endif
+
 //==============================================================================
 
 // Platform defs...
@@ -224,3 +224,39 @@
 #endif
 
 //==============================================================================
+
+/**
+ * 256-bit `Vector` types (`double_4`, `float_8`) are only available when the
+ * compiler targets AVX. VCV Rack builds plugins for `-march=nehalem`, which
+ * has no AVX, so these types are opt-in; define `STONEYDSP_USING_AVX` as `0`
+ * to disable them even when `__AVX__` is defined.
+ */
+#if STONEYDSP_INTEL && defined (__AVX__) && !defined (STONEYDSP_USING_AVX)
+ #define STONEYDSP_USING_AVX 1
+#endif
+
+//==============================================================================
+
+/**
+ * The size, in bytes, of a CPU cache line. Buffers aligned and padded to it
+ * never straddle two lines, nor share one with unrelated data. Apple silicon
+ * uses 128-byte lines; define `STONEYDSP_CACHE_LINE_SIZE` to override.
+ */
+#ifndef STONEYDSP_CACHE_LINE_SIZE
+ #if STONEYDSP_ARM && (STONEYDSP_MAC || STONEYDSP_IOS)
+  #define STONEYDSP_CACHE_LINE_SIZE 128
+ #else
+  #define STONEYDSP_CACHE_LINE_SIZE 64
+ #endif
+#endif
+
+/**
+ * `new` honours the alignment of over-aligned types (such as cache-line
+ * aligned buffers) only from C++17. Before that, heap-allocated objects are
+ * merely aligned to 16 bytes by the common allocators.
+ */
+#if defined (__cpp_aligned_new) && !defined (STONEYDSP_HAS_ALIGNED_NEW)
+ #define STONEYDSP_HAS_ALIGNED_NEW 1
+#endif
+
+//==============================================================================
@@ -48,64 +48,210 @@
 //==============================================================================
 
 namespace StoneyDSP {
-
+/** @addtogroup StoneyDSP
+ *  @{
+ */
 namespace DSP {
+/** @addtogroup DSP
+ *  @{
+ */
 
+/**
+ * @brief The `Gain` class. Multiplies samples by a gain, either one at a time
+ * or in contiguous blocks.
+ *
+ * When the gain is changed by `setGain()`, the next block processed by
+ * `process()` ramps linearly from the previous gain (`getLastGain()`) to the
+ * new one, reaching it on the last sample of the block, so that a gain which
+ * is only updated at block rate does not cause zipper noise.
+ *
+ * @tparam T The gain type; `float`, `double`, `float_4` or `double_2`.
+ * @tparam S The sample type; `T` by default.
+ */
 template <typename T, typename S = T>
 class Gain {
 public:
-    T currentGain;
-    Gain();
-    Gain(T newGain);
-    ~Gain();
-    const T& getGain() const;
-    void setGain(const T& newGain);
-    void processSample(S sample);
+    Gain() noexcept;
+
+    Gain(T newGain) noexcept;
+
+    ~Gain() noexcept;
+
+    /**
+     * @brief Returns the gain, which is reached at the end of each block.
+     *
+     */
+    const T& getGain() const noexcept;
+
+    /**
+     * @brief Returns the gain that the next block ramps from; equal to
+     * `getGain()` once a ramp has completed.
+     *
+     */
+    const T& getLastGain() const noexcept;
+
+    /**
+     * @brief Sets the gain that the next block ramps towards. The last gain
+     * is left alone, so the ramp always starts from the gain that the previous
+     * block ended on, however many times this is called between blocks.
+     *
+     * @param newGain
+     */
+    void setGain(const T& newGain) noexcept;
+
+    /**
+     * @brief Sets both the gain and the last gain, so that the next block
+     * does not ramp.
+     *
+     * @param newGain
+     */
+    void reset(const T& newGain) noexcept;
+
+    /**
+     * @brief Returns `sample` multiplied by the gain, which is applied at
+     * once rather than ramped towards; the next block ramps from it, so that
+     * single samples and blocks may be mixed without a step.
+     *
+     * @param sample
+     * @return S
+     */
+    S processSample(const S& sample) noexcept;
+
+    /**
+     * @brief Applies the gain to `numSamples` contiguous samples from
+     * `input`, writing them to `output`, ramping from the last gain as above.
+     * `input` and `output` may be the same buffer.
+     *
+     * @param input
+     * @param output
+     * @param numSamples
+     */
+    void process(const S* input, S* output, ::StoneyDSP::size_t numSamples) noexcept;
+
+    /**
+     * @brief Sets the gain to `targetGain`, then processes the block as
+     * above, ramping towards it.
+     *
+     * @param input
+     * @param output
+     * @param numSamples
+     * @param targetGain
+     */
+    void process(const S* input, S* output, ::StoneyDSP::size_t numSamples, const T& targetGain) noexcept;
+
+    /**
+     * @brief Applies the gain to `numSamples` contiguous samples in place,
+     * ramping from the last gain as above.
+     *
+     * @param buffer
+     * @param numSamples
+     */
+    void process(S* buffer, ::StoneyDSP::size_t numSamples) noexcept;
+
 private:
+    T gain;
+    T lastGain;
     STONEYDSP_DECLARE_NON_COPYABLE(Gain)
     STONEYDSP_DECLARE_NON_MOVEABLE(Gain)
     STONEYDSP_PREVENT_HEAP_ALLOCATION
 };
 
+  /// @} group DSP
+} // namespace DSP
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
+
+//==============================================================================
+
+template <typename T, typename S>
+::StoneyDSP::DSP::Gain<T, S>::Gain() noexcept
+ : gain(static_cast<T>(0.0)),
+   lastGain(static_cast<T>(0.0))
+{
+
 }
+
+template <typename T, typename S>
+::StoneyDSP::DSP::Gain<T, S>::Gain(T newGain) noexcept
+ : gain(newGain),
+   lastGain(newGain)
+{
+
 }
 
 template <typename T, typename S>
-::StoneyDSP::DSP::Gain<T, S>::Gain()
- : currentGain((T)0.0)
+::StoneyDSP::DSP::Gain<T, S>::~Gain() noexcept
 {
 
 }
 
 template <typename T, typename S>
-::StoneyDSP::DSP::Gain<T, S>::Gain(T newGain)
- : currentGain(newGain)
+const T& ::StoneyDSP::DSP::Gain<T, S>::getGain() const noexcept
 {
+    return this->gain;
+}
 
+template <typename T, typename S>
+const T& ::StoneyDSP::DSP::Gain<T, S>::getLastGain() const noexcept
+{
+    return this->lastGain;
 }
 
 template <typename T, typename S>
-::StoneyDSP::DSP::Gain<T, S>::~Gain()
+void ::StoneyDSP::DSP::Gain<T, S>::setGain(const T& newGain) noexcept
 {
+    this->gain = newGain;
+}
 
+template <typename T, typename S>
+void ::StoneyDSP::DSP::Gain<T, S>::reset(const T& newGain) noexcept
+{
+    this->gain = newGain;
+    this->lastGain = newGain;
 }
 
 template <typename T, typename S>
-void ::StoneyDSP::DSP::Gain<T, S>::processSample(S sample)
+S StoneyDSP::DSP::Gain<T, S>::processSample(const S& sample) noexcept
 {
-    sample *= getGain();
+    this->lastGain = this->gain;
+    return sample * this->gain;
 }
 
-template <class T, class S>
-const T& ::StoneyDSP::DSP::Gain<T, S>::getGain() const
+template <typename T, typename S>
+void ::StoneyDSP::DSP::Gain<T, S>::process(const S* input, S* output, ::StoneyDSP::size_t numSamples) noexcept
 {
-    return currentGain;
+    if (numSamples == 0U) {
+        return;
+    }
+
+    // Keep the ramp in locals so it isn't reloaded through `this` per sample
+    const T step = (this->gain - this->lastGain) / static_cast<T>(numSamples);
+    T g = this->lastGain;
+
+    for (::StoneyDSP::size_t i = 0U; i + 1U < numSamples; ++i) {
+        g += step;
+        output[i] = input[i] * g;
+    }
+
+    // The ramp ends exactly on the gain, however the steps rounded
+    output[numSamples - 1U] = input[numSamples - 1U] * this->gain;
+
+    // The ramp is complete
+    this->lastGain = this->gain;
+}
+
+template <typename T, typename S>
+void ::StoneyDSP::DSP::Gain<T, S>::process(const S* input, S* output, ::StoneyDSP::size_t numSamples, const T& targetGain) noexcept
+{
+    this->setGain(targetGain);
+    this->process(input, output, numSamples);
 }
 
-template <class T, class S>
-void ::StoneyDSP::DSP::Gain<T, S>::setGain(const T& newGain)
+template <typename T, typename S>
+void ::StoneyDSP::DSP::Gain<T, S>::process(S* buffer, ::StoneyDSP::size_t numSamples) noexcept
 {
-    currentGain = newGain;
+    this->process(buffer, buffer, numSamples);
 }
 
 //==============================================================================
@@ -114,5 +260,9 @@ template class ::StoneyDSP::DSP::Gain<::StoneyDSP::double_t>;
 template class ::StoneyDSP::DSP::Gain<::StoneyDSP::float_t>;
 template class ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::double_2>;
 template class ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::float_4>;
+#if STONEYDSP_USING_AVX
+template class ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::double_4>;
+template class ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::float_8>;
+#endif
 
 //==============================================================================
@@ -54,6 +54,41 @@ namespace DSP {
  *  @{
  */
 
+/**
+ * @brief A branch-free Schmitt trigger. Updates `state` from `input`, and
+ * returns `1` wherever `input` rises to `highThreshold` after having fallen
+ * to `lowThreshold`, otherwise `0`.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @param input
+ * @param state The trigger's state; `1` while high and `0` while low.
+ * @param lowThreshold
+ * @param highThreshold
+ * @return `1` where there was a rising edge, otherwise `0`.
+ */
+template <class T>
+inline T risingEdge(const T& input, T& state, const T& lowThreshold, const T& highThreshold) noexcept
+{
+    const T one = static_cast<T>(1.0F);
+    const T zero = static_cast<T>(0.0F);
+    // While high, wait for the low threshold; while low, for the high one
+    const T newState = ::StoneyDSP::SIMD::ifelse(
+        state > zero,
+        ::StoneyDSP::SIMD::ifelse(input <= lowThreshold, zero, one),
+        ::StoneyDSP::SIMD::ifelse(input >= highThreshold, one, zero)
+    );
+    const T edge = newState - ::StoneyDSP::SIMD::fmin(newState, state);
+    state = newState;
+    return edge;
+}
+
+/**
+ * @brief The `PhaseDriver` class. A normalized `[0, 1)` phase accumulator,
+ * advanced by `freq` (in Hz) times the sample time on each call to
+ * `process()`.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ */
 template <class T>
 class PhaseDriver
 {
@@ -66,30 +101,288 @@ public:
     PhaseDriver() = default;
     ~PhaseDriver() = default;
 
+    /**
+     * @brief Advances the phase by `freq * deltaTime` and wraps it into
+     * `[0, 1)`.
+     *
+     * @param deltaTime The sample time, in seconds.
+     * @return The new phase.
+     */
+    T process(const T& deltaTime) noexcept;
+
+    /**
+     * @brief Advances the phase `numSamples` times, as `process()`, writing
+     * each new phase to `phases`.
+     *
+     * @param deltaTime The sample time, in seconds.
+     * @param phases
+     * @param numSamples
+     */
+    void process(const T& deltaTime, T* phases, ::StoneyDSP::size_t numSamples) noexcept;
+
+    /**
+     * @brief Resets the phase to `0`.
+     *
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Resets the phase to `0` only where `mask` is set, e.g. in the
+     * lanes of a `Vector` where a comparison held.
+     *
+     * @param mask
+     */
+    void reset(const T& mask) noexcept;
+
+    /**
+     * @brief Hard sync. Passes `input` through a Schmitt trigger, and resets
+     * the phase to `0` wherever it has a rising edge, i.e. where `input`
+     * rises to `highThreshold` after having fallen to `lowThreshold`.
+     *
+     * @param input
+     * @param lowThreshold
+     * @param highThreshold
+     * @return `1` where there was a rising edge, otherwise `0`.
+     */
+    T sync(const T& input, const T& lowThreshold = static_cast<T>(0.1F), const T& highThreshold = static_cast<T>(2.0F)) noexcept;
+
 private:
+    /**
+     * @brief The state of the hard sync Schmitt trigger; `1` while high and
+     * `0` while low. Starts high, so that an input which is already high
+     * does not trigger a reset.
+     *
+     */
+    T syncState = 1.f;
+
     STONEYDSP_DECLARE_NON_COPYABLE(PhaseDriver)
     STONEYDSP_DECLARE_NON_MOVEABLE(PhaseDriver)
     STONEYDSP_PREVENT_HEAP_ALLOCATION
 };
 
+template <class T>
+T StoneyDSP::DSP::PhaseDriver<T>::process(const T& deltaTime) noexcept
+{
+    this->phase += this->freq * deltaTime;
+    this->phase -= ::StoneyDSP::SIMD::floor(this->phase);
+    return this->phase;
+}
+
+template <class T>
+void StoneyDSP::DSP::PhaseDriver<T>::process(const T& deltaTime, T* phases, ::StoneyDSP::size_t numSamples) noexcept
+{
+    // Keep the phase in a local so it isn't reloaded through `this` per sample
+    const T delta = this->freq * deltaTime;
+    T p = this->phase;
+
+    for (::StoneyDSP::size_t i = 0U; i < numSamples; ++i) {
+        p += delta;
+        p -= ::StoneyDSP::SIMD::floor(p);
+        phases[i] = p;
+    }
+
+    this->phase = p;
+}
+
+template <class T>
+void StoneyDSP::DSP::PhaseDriver<T>::reset() noexcept
+{
+    this->phase = static_cast<T>(0.0F);
+}
+
+template <class T>
+void StoneyDSP::DSP::PhaseDriver<T>::reset(const T& mask) noexcept
+{
+    this->phase = ::StoneyDSP::SIMD::ifelse(mask, static_cast<T>(0.0F), this->phase);
+}
+
+template <class T>
+T StoneyDSP::DSP::PhaseDriver<T>::sync(const T& input, const T& lowThreshold, const T& highThreshold) noexcept
+{
+    const T edge = ::StoneyDSP::DSP::risingEdge(input, this->syncState, lowThreshold, highThreshold);
+    this->reset(edge > static_cast<T>(0.0F));
+    return edge;
+}
+
 template class ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::double_t>;
 template class ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::float_t>;
 template class ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::double_2>;
 template class ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::float_4>;
 
+/**
+ * @brief The PolyBLEP residual: a two-sample polynomial correction that,
+ * added at a unit step discontinuity, band-limits it. Only the samples
+ * within one phase increment `dt` either side of the discontinuity (at
+ * `t == 0`, which is also `t == 1`) are corrected; elsewhere it is `0`.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @param t The phase, in `[0, 1)`, relative to the discontinuity.
+ * @param dt The phase increment per sample, in `[0, 0.5)`.
+ * @return The correction, in `[-1, 1]`, for a step of height `2`.
+ */
+template <class T>
+inline T polyBlep(const T& t, const T& dt) noexcept
+{
+    // Just after the discontinuity
+    const T x0 = t / dt;
+    const T after = x0 + x0 - x0 * x0 - static_cast<T>(1.0);
+    // Just before the discontinuity
+    const T x1 = (t - static_cast<T>(1.0)) / dt;
+    const T before = x1 * x1 + x1 + x1 + static_cast<T>(1.0);
+
+    return ::StoneyDSP::SIMD::ifelse(
+        t < dt,
+        after,
+        ::StoneyDSP::SIMD::ifelse(t > static_cast<T>(1.0) - dt, before, static_cast<T>(0.0))
+    );
+}
+
+/**
+ * @brief A rising sawtooth, band-limited with PolyBLEP.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @param phase The phase, in `[0, 1)`.
+ * @param dt The phase increment per sample, in `[0, 0.5)`.
+ * @return The sawtooth, in `[-1, 1]`.
+ */
+template <class T>
+inline T polyBlepSaw(const T& phase, const T& dt) noexcept
+{
+    const T naive = static_cast<T>(2.0) * phase - static_cast<T>(1.0);
+    return naive - ::StoneyDSP::DSP::polyBlep(phase, dt);
+}
+
+/**
+ * @brief A pulse, high for the first `width` of the period, band-limited
+ * with PolyBLEP at both of its edges.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @param phase The phase, in `[0, 1)`.
+ * @param dt The phase increment per sample, in `[0, 0.5)`.
+ * @param width The pulse width, in `(0, 1)`.
+ * @return The pulse, in `[-1, 1]`.
+ */
+template <class T>
+inline T polyBlepPulse(const T& phase, const T& dt, const T& width) noexcept
+{
+    const T naive = ::StoneyDSP::SIMD::ifelse(phase < width, static_cast<T>(1.0), static_cast<T>(-1.0));
+    // The falling edge, at `phase == width`
+    T fall = phase - width;
+    fall -= ::StoneyDSP::SIMD::floor(fall);
+    return naive
+        + ::StoneyDSP::DSP::polyBlep(phase, dt)
+        - ::StoneyDSP::DSP::polyBlep(fall, dt);
+}
+
+/**
+ * @brief The `Oscillator` class. Derives its waveforms from the phase of a
+ * `PhaseDriver`; the discontinuous waveforms are band-limited with PolyBLEP
+ * so that they may be run at audio rate without (significant) aliasing.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ */
 template <class T>
 class Oscillator : StoneyDSP::DSP::PhaseDriver<T>
 {
 public:
+    using StoneyDSP::DSP::PhaseDriver<T>::phase;
+    using StoneyDSP::DSP::PhaseDriver<T>::freq;
+    using StoneyDSP::DSP::PhaseDriver<T>::reset;
+    using StoneyDSP::DSP::PhaseDriver<T>::sync;
+
     Oscillator() = default;
     ~Oscillator() = default;
 
+    /**
+     * @brief Advances the phase by `freq * deltaTime`, wraps it into
+     * `[0, 1)`, and stores the phase increment for the PolyBLEP corrections.
+     *
+     * @param deltaTime The sample time, in seconds.
+     * @return The new phase.
+     */
+    T process(const T& deltaTime) noexcept;
+
+    /**
+     * @brief Takes the phase from an external accumulator, e.g. one running
+     * at a higher precision than `T`, in place of `process()`; stores the
+     * phase increment for the PolyBLEP corrections as `process()` does.
+     *
+     * @param newPhase The phase, in `[0, 1)`.
+     * @param deltaTime The sample time, in seconds.
+     * @return The new phase.
+     */
+    T setPhase(const T& newPhase, const T& deltaTime) noexcept;
+
+    /**
+     * @brief Returns the sine of the current phase, in `[-1, 1]`.
+     *
+     * @tparam A The accuracy tier of the approximation.
+     */
+    template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium>
+    T sin() const noexcept;
+
+    /**
+     * @brief Returns the band-limited rising sawtooth of the current phase,
+     * in `[-1, 1]`.
+     *
+     */
+    T saw() const noexcept;
+
+    /**
+     * @brief Returns the band-limited pulse of the current phase, in
+     * `[-1, 1]`; high for the first `width` of the period.
+     *
+     * @param width The pulse width, in `(0, 1)`.
+     */
+    T pulse(const T& width) const noexcept;
+
 private:
+    /**
+     * @brief The phase increment of the last call to `process()` or
+     * `setPhase()`.
+     *
+     */
+    T delta = 0.f;
+
     STONEYDSP_DECLARE_NON_COPYABLE(Oscillator)
     STONEYDSP_DECLARE_NON_MOVEABLE(Oscillator)
     STONEYDSP_PREVENT_HEAP_ALLOCATION
 };
 
+template <class T>
+T StoneyDSP::DSP::Oscillator<T>::process(const T& deltaTime) noexcept
+{
+    this->delta = ::StoneyDSP::SIMD::fabs(this->freq * deltaTime);
+    return StoneyDSP::DSP::PhaseDriver<T>::process(deltaTime);
+}
+
+template <class T>
+T StoneyDSP::DSP::Oscillator<T>::setPhase(const T& newPhase, const T& deltaTime) noexcept
+{
+    this->delta = ::StoneyDSP::SIMD::fabs(this->freq * deltaTime);
+    this->phase = newPhase;
+    return this->phase;
+}
+
+template <class T>
+template <::StoneyDSP::SIMD::SineAccuracy A>
+T StoneyDSP::DSP::Oscillator<T>::sin() const noexcept
+{
+    return ::StoneyDSP::SIMD::sin2pi<A>(this->phase);
+}
+
+template <class T>
+T StoneyDSP::DSP::Oscillator<T>::saw() const noexcept
+{
+    return ::StoneyDSP::DSP::polyBlepSaw(this->phase, this->delta);
+}
+
+template <class T>
+T StoneyDSP::DSP::Oscillator<T>::pulse(const T& width) const noexcept
+{
+    return ::StoneyDSP::DSP::polyBlepPulse(this->phase, this->delta, width);
+}
+
 template class ::StoneyDSP::DSP::Oscillator<::StoneyDSP::double_t>;
 template class ::StoneyDSP::DSP::Oscillator<::StoneyDSP::float_t>;
 template class ::StoneyDSP::DSP::Oscillator<::StoneyDSP::SIMD::double_2>;
@@ -124,6 +124,9 @@ namespace SIMD {
 //==============================================================================
 
 #include "StoneyDSP/SIMD/Vector.hpp"
+#include "StoneyDSP/SIMD/Sine.hpp"
+#include "StoneyDSP/SIMD/Math.hpp"
+#include "StoneyDSP/SIMD/PolyBuffer.hpp"
 
 // template <>
 // struct Vector<float, 4> {
@@ -0,0 +1,510 @@
+/***************************************************************************//**
+ * @file Math.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief
+ * @version 0.0.0
+ * @date 2024-11-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * therights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/orsell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#pragma once
+
+#define STONEYDSP_SIMD_MATH_HPP_INCLUDED 1
+
+//==============================================================================
+
+#ifndef STONEYDSP_CORE_HPP_INCLUDED
+ #include "StoneyDSP/Core.hpp"
+#endif
+
+#ifndef STONEYDSP_SIMD_VECTOR_HPP_INCLUDED
+ #include "StoneyDSP/SIMD/Vector.hpp"
+#endif
+
+//==============================================================================
+
+/**
+ * @brief This file describes fast, branch-free approximations of `exp2`,
+ * `log2`, `pow` and `tanh` for `float`, `double`, `float_4` and `double_2`
+ * (and `float_8` and `double_4` when built for AVX), so that SIMD engines (e.g. V/Oct to Hz conversion, exponential gain
+ * curves) need not spill to scalar libm per lane.
+ *
+ * `exp2` splits its argument into an integer and a fraction in
+ * `[-0.5, 0.5]`; the fraction is approximated by a minimax polynomial and the
+ * integer is added straight into the exponent bits. `log2` splits its
+ * argument into exponent and mantissa, re-centres the mantissa on `1` and
+ * approximates `log2(m)` as `s * P(s * s)`, where `s = (m - 1) / (m + 1)`.
+ * `pow` and `tanh` are built from the two.
+ *
+ * The maximum errors, measured against libm, are:
+ *
+ * | function | `float`, `float_4`    | `double`, `double_2`  |
+ * |----------|-----------------------|-----------------------|
+ * | `exp2`   | `2.5e-7` relative     | `4.8e-16` relative    |
+ * | `log2`   | `1.2e-7` absolute (1) | `3.4e-16` absolute (1)|
+ * | `pow`    | `7.1e-7` relative (2) | `1.8e-15` relative (2)|
+ * | `tanh`   | `1.6e-7` absolute     | `3.4e-16` absolute    |
+ *
+ * (1) For `x` in `[0.5, 2]`; elsewhere the relative error is below `1.0e-7`
+ * (`float`) or `2.3e-16` (`double`).
+ *
+ * (2) For `|y * log2(x)| < 8`; the error grows with the magnitude of the
+ * result's exponent, as it does for any `exp2(y * log2(x))`.
+ *
+ * The domains are:
+ *
+ * - `exp2(x)` - any `x` but NaN; `x` is clamped to `[-126, 127]` (`float`)
+ * or `[-1022, 1023]` (`double`), so that the result is finite and normal.
+ * - `log2(x)` - finite, normal `x > 0`. Zero, negative, denormal, infinite
+ * and NaN arguments return unspecified values.
+ * - `pow(x, y)` - as `log2(x)`.
+ * - `tanh(x)` - any `x` but NaN.
+ *
+ * `sin` and `cos` are described in `Sine.hpp`.
+ *
+ * @example
+ * ```cpp
+ * ::StoneyDSP::SIMD::float_4 voct {-1.0F, 0.0F, 1.0F, 2.0F};
+ * ::StoneyDSP::SIMD::float_4 hz = 2.0F * ::StoneyDSP::SIMD::exp2(voct); // {1, 2, 4, 8}
+ * ```
+ */
+
+//==============================================================================
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+//==============================================================================
+
+namespace SIMD {
+/** @addtogroup SIMD
+ *  @{
+ */
+
+//==============================================================================
+
+/**
+ * @brief Per-type access to the exponent bits of floating point numbers.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`; and `float_8` or
+ * `double_4` when built for AVX.
+ */
+template <typename T>
+struct FloatBits;
+
+template <>
+struct FloatBits<::StoneyDSP::float_t>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::float_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-126, 127]`.
+     *
+     */
+    static ::StoneyDSP::float_t exp2i(const ::StoneyDSP::float_t& n) noexcept
+    {
+        return ::std::ldexp(1.0F, static_cast<int>(n));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::float_t frexp(const ::StoneyDSP::float_t& x, ::StoneyDSP::float_t& e) noexcept
+    {
+        int i;
+        const ::StoneyDSP::float_t m = ::std::frexp(x, &i);
+        e = static_cast<::StoneyDSP::float_t>(i - 1);
+        return m * 2.0F;
+    }
+};
+
+template <>
+struct FloatBits<::StoneyDSP::double_t>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::double_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-1022, 1023]`.
+     *
+     */
+    static ::StoneyDSP::double_t exp2i(const ::StoneyDSP::double_t& n) noexcept
+    {
+        return ::std::ldexp(1.0, static_cast<int>(n));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::double_t frexp(const ::StoneyDSP::double_t& x, ::StoneyDSP::double_t& e) noexcept
+    {
+        int i;
+        const ::StoneyDSP::double_t m = ::std::frexp(x, &i);
+        e = static_cast<::StoneyDSP::double_t>(i - 1);
+        return m * 2.0;
+    }
+};
+
+template <>
+struct FloatBits<::StoneyDSP::SIMD::float_4>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::float_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-126, 127]`.
+     *
+     */
+    static ::StoneyDSP::SIMD::float_4 exp2i(const ::StoneyDSP::SIMD::float_4& n) noexcept
+    {
+        const __m128i biased = _mm_add_epi32(_mm_cvtps_epi32(n.v), _mm_set1_epi32(127));
+        return ::StoneyDSP::SIMD::float_4(_mm_castsi128_ps(_mm_slli_epi32(biased, 23)));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::SIMD::float_4 frexp(const ::StoneyDSP::SIMD::float_4& x, ::StoneyDSP::SIMD::float_4& e) noexcept
+    {
+        const __m128i bits = _mm_castps_si128(x.v);
+        const __m128i biased = _mm_srli_epi32(bits, 23);
+        e = ::StoneyDSP::SIMD::float_4(_mm_cvtepi32_ps(_mm_sub_epi32(biased, _mm_set1_epi32(127))));
+        const __m128i mantissa = _mm_or_si128(
+            _mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+            _mm_set1_epi32(0x3F800000)
+        );
+        return ::StoneyDSP::SIMD::float_4(_mm_castsi128_ps(mantissa));
+    }
+};
+
+template <>
+struct FloatBits<::StoneyDSP::SIMD::double_2>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::double_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-1022, 1023]`.
+     *
+     */
+    static ::StoneyDSP::SIMD::double_2 exp2i(const ::StoneyDSP::SIMD::double_2& n) noexcept
+    {
+        // There is no packed double to int64 conversion before AVX-512, but
+        // `n` fits in an int32.
+        const __m128i biased = _mm_add_epi64(_mm_cvtepi32_epi64(_mm_cvtpd_epi32(n.v)), _mm_set1_epi64x(1023));
+        return ::StoneyDSP::SIMD::double_2(_mm_castsi128_pd(_mm_slli_epi64(biased, 52)));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::SIMD::double_2 frexp(const ::StoneyDSP::SIMD::double_2& x, ::StoneyDSP::SIMD::double_2& e) noexcept
+    {
+        const __m128i bits = _mm_castpd_si128(x.v);
+        // The biased exponents fit in the low 32 bits of each lane; gather
+        // them into the low two int32 lanes for the conversion.
+        const __m128i biased = _mm_shuffle_epi32(_mm_srli_epi64(bits, 52), _MM_SHUFFLE(2, 0, 2, 0));
+        e = ::StoneyDSP::SIMD::double_2(_mm_cvtepi32_pd(_mm_sub_epi32(biased, _mm_set1_epi32(1023))));
+        const __m128i mantissa = _mm_or_si128(
+            _mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+            _mm_set1_epi64x(0x3FF0000000000000LL)
+        );
+        return ::StoneyDSP::SIMD::double_2(_mm_castsi128_pd(mantissa));
+    }
+};
+
+#if STONEYDSP_USING_AVX
+// AVX has no 256-bit integer arithmetic (that came with AVX2), so the wide
+// vectors' exponent bits are handled as two 128-bit halves.
+
+template <>
+struct FloatBits<::StoneyDSP::SIMD::float_8>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::float_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-126, 127]`.
+     *
+     */
+    static ::StoneyDSP::SIMD::float_8 exp2i(const ::StoneyDSP::SIMD::float_8& n) noexcept
+    {
+        const ::StoneyDSP::SIMD::float_4 lo = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::float_4>::exp2i(::StoneyDSP::SIMD::float_4(_mm256_castps256_ps128(n.v)));
+        const ::StoneyDSP::SIMD::float_4 hi = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::float_4>::exp2i(::StoneyDSP::SIMD::float_4(_mm256_extractf128_ps(n.v, 1)));
+        return ::StoneyDSP::SIMD::float_8(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.v), hi.v, 1));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::SIMD::float_8 frexp(const ::StoneyDSP::SIMD::float_8& x, ::StoneyDSP::SIMD::float_8& e) noexcept
+    {
+        ::StoneyDSP::SIMD::float_4 eLo, eHi;
+        const ::StoneyDSP::SIMD::float_4 lo = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::float_4>::frexp(::StoneyDSP::SIMD::float_4(_mm256_castps256_ps128(x.v)), eLo);
+        const ::StoneyDSP::SIMD::float_4 hi = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::float_4>::frexp(::StoneyDSP::SIMD::float_4(_mm256_extractf128_ps(x.v, 1)), eHi);
+        e = ::StoneyDSP::SIMD::float_8(_mm256_insertf128_ps(_mm256_castps128_ps256(eLo.v), eHi.v, 1));
+        return ::StoneyDSP::SIMD::float_8(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.v), hi.v, 1));
+    }
+};
+
+template <>
+struct FloatBits<::StoneyDSP::SIMD::double_4>
+{
+    /** The underlying scalar type. */
+    using scalar_type = ::StoneyDSP::double_t;
+
+    /**
+     * @brief Returns `2^n`, for integral `n` in `[-1022, 1023]`.
+     *
+     */
+    static ::StoneyDSP::SIMD::double_4 exp2i(const ::StoneyDSP::SIMD::double_4& n) noexcept
+    {
+        const ::StoneyDSP::SIMD::double_2 lo = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::double_2>::exp2i(::StoneyDSP::SIMD::double_2(_mm256_castpd256_pd128(n.v)));
+        const ::StoneyDSP::SIMD::double_2 hi = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::double_2>::exp2i(::StoneyDSP::SIMD::double_2(_mm256_extractf128_pd(n.v, 1)));
+        return ::StoneyDSP::SIMD::double_4(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo.v), hi.v, 1));
+    }
+
+    /**
+     * @brief Splits finite, normal `x > 0` into a mantissa in `[1, 2)`, which
+     * is returned, and an exponent, which is written to `e`.
+     *
+     */
+    static ::StoneyDSP::SIMD::double_4 frexp(const ::StoneyDSP::SIMD::double_4& x, ::StoneyDSP::SIMD::double_4& e) noexcept
+    {
+        ::StoneyDSP::SIMD::double_2 eLo, eHi;
+        const ::StoneyDSP::SIMD::double_2 lo = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::double_2>::frexp(::StoneyDSP::SIMD::double_2(_mm256_castpd256_pd128(x.v)), eLo);
+        const ::StoneyDSP::SIMD::double_2 hi = ::StoneyDSP::SIMD::FloatBits<::StoneyDSP::SIMD::double_2>::frexp(::StoneyDSP::SIMD::double_2(_mm256_extractf128_pd(x.v, 1)), eHi);
+        e = ::StoneyDSP::SIMD::double_4(_mm256_insertf128_pd(_mm256_castpd128_pd256(eLo.v), eHi.v, 1));
+        return ::StoneyDSP::SIMD::double_4(_mm256_insertf128_pd(_mm256_castpd128_pd256(lo.v), hi.v, 1));
+    }
+};
+#endif
+
+//==============================================================================
+
+/**
+ * @brief The minimax polynomials approximating `exp2(f)` for `f` in
+ * `[-0.5, 0.5]`; degree 5 for `float` precision and degree 10 for `double`.
+ * Both are exactly `1` at `f == 0`, so that whole octaves are exact.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @tparam S The underlying scalar type of `T`.
+ */
+template <typename T, typename S = typename ::StoneyDSP::SIMD::FloatBits<T>::scalar_type>
+struct Exp2Polynomial;
+
+template <typename T>
+struct Exp2Polynomial<T, ::StoneyDSP::float_t>
+{
+    static T process(const T& f) noexcept
+    {
+        return static_cast<T>(1.0F) +
+               f * (static_cast<T>(0.69314714350642448F) +
+               f * (static_cast<T>(0.24022351343142204F) +
+               f * (static_cast<T>(0.055505002127125287F) +
+               f * (static_cast<T>(0.0096662454265339648F) +
+               f *  static_cast<T>(0.0013333538980296901F)))));
+    }
+};
+
+template <typename T>
+struct Exp2Polynomial<T, ::StoneyDSP::double_t>
+{
+    static T process(const T& f) noexcept
+    {
+        return static_cast<T>(1.0) +
+               f * (static_cast<T>(0.69314718055994973) +
+               f * (static_cast<T>(0.24022650695908768) +
+               f * (static_cast<T>(0.055504108664458832) +
+               f * (static_cast<T>(0.009618129108034593) +
+               f * (static_cast<T>(0.0013333558228561526) +
+               f * (static_cast<T>(0.000154035299611317) +
+               f * (static_cast<T>(1.5252658116550125e-05) +
+               f * (static_cast<T>(1.3215662834036175e-06) +
+               f * (static_cast<T>(1.0208537903289228e-07) +
+               f *  static_cast<T>(7.0372791317480845e-09))))))))));
+    }
+};
+
+/**
+ * @brief The minimax polynomials `P(z)` such that `log2(m) == s * P(s * s)`,
+ * where `s = (m - 1) / (m + 1)`, for `m` in `[sqrt(1/2), sqrt(2))`; degree 3
+ * for `float` precision and degree 6 for `double`.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @tparam S The underlying scalar type of `T`.
+ */
+template <typename T, typename S = typename ::StoneyDSP::SIMD::FloatBits<T>::scalar_type>
+struct Log2Polynomial;
+
+template <typename T>
+struct Log2Polynomial<T, ::StoneyDSP::float_t>
+{
+    static T process(const T& z) noexcept
+    {
+        return static_cast<T>(2.8853900797889267F) +
+               z * (static_cast<T>(0.96179884764174295F) +
+               z * (static_cast<T>(0.57671438396246788F) +
+               z *  static_cast<T>(0.43173587920703854F)));
+    }
+};
+
+template <typename T>
+struct Log2Polynomial<T, ::StoneyDSP::double_t>
+{
+    static T process(const T& z) noexcept
+    {
+        return static_cast<T>(2.8853900817779272) +
+               z * (static_cast<T>(0.96179669392432454) +
+               z * (static_cast<T>(0.5770780172502934) +
+               z * (static_cast<T>(0.41219840147305303) +
+               z * (static_cast<T>(0.32061642584628425) +
+               z * (static_cast<T>(0.26144310984446534) +
+               z *  static_cast<T>(0.24292899507854179))))));
+    }
+};
+
+/**
+ * @brief The limits applied to the argument of `exp2()` (so that the result
+ * is finite and normal) and `tanh()` (beyond which it rounds to `+/-1`).
+ *
+ * @tparam S The underlying scalar type.
+ */
+template <typename S>
+struct MathLimits;
+
+template <>
+struct MathLimits<::StoneyDSP::float_t>
+{
+    static constexpr ::StoneyDSP::float_t exp2Min() noexcept { return -126.0F; }
+    static constexpr ::StoneyDSP::float_t exp2Max() noexcept { return 127.0F; }
+    static constexpr ::StoneyDSP::float_t tanhMax() noexcept { return 9.0F; }
+};
+
+template <>
+struct MathLimits<::StoneyDSP::double_t>
+{
+    static constexpr ::StoneyDSP::double_t exp2Min() noexcept { return -1022.0; }
+    static constexpr ::StoneyDSP::double_t exp2Max() noexcept { return 1023.0; }
+    static constexpr ::StoneyDSP::double_t tanhMax() noexcept { return 19.0; }
+};
+
+//==============================================================================
+
+/**
+ * @brief Returns `2^x`.
+ *
+ * @param x Clamped to `[-126, 127]` (`float`) or `[-1022, 1023]` (`double`).
+ * @return T
+ */
+template <typename T>
+inline T exp2(const T& x) noexcept
+{
+    using S = typename ::StoneyDSP::SIMD::FloatBits<T>::scalar_type;
+    const T xc = ::StoneyDSP::SIMD::fmin(
+        ::StoneyDSP::SIMD::fmax(x, static_cast<T>(::StoneyDSP::SIMD::MathLimits<S>::exp2Min())),
+        static_cast<T>(::StoneyDSP::SIMD::MathLimits<S>::exp2Max())
+    );
+    const T n = ::StoneyDSP::SIMD::floor(xc + static_cast<T>(0.5));
+    return ::StoneyDSP::SIMD::Exp2Polynomial<T>::process(xc - n) * ::StoneyDSP::SIMD::FloatBits<T>::exp2i(n);
+}
+
+/**
+ * @brief Returns `log2(x)`.
+ *
+ * @param x Finite and normal, `x > 0`.
+ * @return T
+ */
+template <typename T>
+inline T log2(const T& x) noexcept
+{
+    T e;
+    T m = ::StoneyDSP::SIMD::FloatBits<T>::frexp(x, e);
+    // Re-centre the mantissa on 1, i.e. into [sqrt(1/2), sqrt(2))
+    const auto high = m > static_cast<T>(1.4142135623730951);
+    m = ::StoneyDSP::SIMD::ifelse(high, m * static_cast<T>(0.5), m);
+    e = ::StoneyDSP::SIMD::ifelse(high, e + static_cast<T>(1.0), e);
+    const T s = (m - static_cast<T>(1.0)) / (m + static_cast<T>(1.0));
+    return e + s * ::StoneyDSP::SIMD::Log2Polynomial<T>::process(s * s);
+}
+
+/**
+ * @brief Returns `x^y`, as `exp2(y * log2(x))`.
+ *
+ * @param x Finite and normal, `x > 0`.
+ * @param y
+ * @return T
+ */
+template <typename T>
+inline T pow(const T& x, const T& y) noexcept
+{
+    return ::StoneyDSP::SIMD::exp2(y * ::StoneyDSP::SIMD::log2(x));
+}
+
+/**
+ * @brief Returns the hyperbolic tangent of `x`.
+ *
+ * @param x
+ * @return T
+ */
+template <typename T>
+inline T tanh(const T& x) noexcept
+{
+    using S = typename ::StoneyDSP::SIMD::FloatBits<T>::scalar_type;
+    const T xc = ::StoneyDSP::SIMD::fmin(
+        ::StoneyDSP::SIMD::fmax(x, static_cast<T>(-::StoneyDSP::SIMD::MathLimits<S>::tanhMax())),
+        static_cast<T>(::StoneyDSP::SIMD::MathLimits<S>::tanhMax())
+    );
+    // tanh(x) == (e^2x - 1) / (e^2x + 1)
+    const T e = ::StoneyDSP::SIMD::exp2(xc * static_cast<T>(2.8853900817779268));
+    return (e - static_cast<T>(1.0)) / (e + static_cast<T>(1.0));
+}
+
+//==============================================================================
+
+  /// @} group SIMD
+} // namespace SIMD
+
+//==============================================================================
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
+
+//==============================================================================
@@ -0,0 +1,232 @@
+/***************************************************************************//**
+ * @file PolyBuffer.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief
+ * @version 0.0.0
+ * @date 2024-11-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * therights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/orsell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#pragma once
+
+#define STONEYDSP_SIMD_POLYBUFFER_HPP_INCLUDED 1
+
+//==============================================================================
+
+#ifndef STONEYDSP_CORE_HPP_INCLUDED
+ #include "StoneyDSP/Core.hpp"
+#endif
+
+#ifndef STONEYDSP_SIMD_VECTOR_HPP_INCLUDED
+ #include "StoneyDSP/SIMD/Vector.hpp"
+#endif
+
+//==============================================================================
+
+/**
+ * @brief This file describes `PolyBuffer`, a fixed-size array of per-voice
+ * values which is aligned and padded to a cache line, so that engines and
+ * modules can move whole `Vector`s in and out of it with aligned loads and
+ * stores that never straddle two cache lines.
+ *
+ * @example
+ * ```cpp
+ * ::StoneyDSP::SIMD::PolyBuffer<float> gains;
+ * gains.store(4U, ::StoneyDSP::SIMD::float_4(0.5F)); // gains[4..7] = 0.5
+ * ::StoneyDSP::SIMD::float_4 g = gains.load<::StoneyDSP::SIMD::float_4>(4U);
+ * ```
+ */
+
+//==============================================================================
+
+/**
+ * The alignment of a `PolyBuffer`: a cache line where heap allocations can
+ * honour it, otherwise the 16 bytes of a 128-bit `Vector`.
+ */
+#if STONEYDSP_HAS_ALIGNED_NEW
+ #define STONEYDSP_POLYBUFFER_ALIGNMENT STONEYDSP_CACHE_LINE_SIZE
+#else
+ #define STONEYDSP_POLYBUFFER_ALIGNMENT 16
+#endif
+
+//==============================================================================
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+//==============================================================================
+
+namespace SIMD {
+/** @addtogroup SIMD
+ *  @{
+ */
+
+//==============================================================================
+
+/**
+ * @brief A cache-line aligned and padded array of `N` values of type `T`,
+ * defaulting to the 16 voices of a polyphonic port.
+ *
+ * @tparam T `float` or `double`.
+ * @tparam N The number of values; `16` by default.
+ *
+ * @note Heap-allocated owners honour over-aligned members only from C++17
+ * (see `STONEYDSP_HAS_ALIGNED_NEW`). Before that, `PolyBuffer` is aligned to
+ * just 16 bytes, and `load()` and `store()` fall back to unaligned
+ * instructions for `Vector`s wider than that.
+ */
+template <typename T, ::StoneyDSP::size_t N = 16U>
+struct alignas(STONEYDSP_POLYBUFFER_ALIGNMENT) PolyBuffer
+{
+    static_assert(N > 0U, "PolyBuffer must hold at least one value");
+
+    /** The type of the values. */
+    using value_type = T;
+
+    /** An iterator over the values. */
+    using iterator = T*;
+
+    /** A read-only iterator over the values. */
+    using const_iterator = const T*;
+
+    /** The values. */
+    T s[N];
+
+    //==========================================================================
+
+    /**
+     * @brief Constructs a new `PolyBuffer` with all values set to `0`.
+     *
+     */
+    PolyBuffer() noexcept : s{} {}
+
+    /**
+     * @brief Constructs a new `PolyBuffer` with all values set to `value`.
+     *
+     * @param value
+     */
+    explicit PolyBuffer(T value) noexcept
+    {
+        this->fill(value);
+    }
+
+    //==========================================================================
+
+    /**
+     * @brief Returns the number of values, `N`.
+     *
+     */
+    static constexpr ::StoneyDSP::size_t size() noexcept
+    {
+        return N;
+    }
+
+    /**
+     * @brief Sets all values to `value`.
+     *
+     * @param value
+     */
+    void fill(T value) noexcept
+    {
+        for (auto &x : this->s) {
+            x = value;
+        }
+    }
+
+    //==========================================================================
+
+    T& operator[](::StoneyDSP::size_t i) noexcept { return this->s[i]; }
+    const T& operator[](::StoneyDSP::size_t i) const noexcept { return this->s[i]; }
+
+    T* data() noexcept { return this->s; }
+    const T* data() const noexcept { return this->s; }
+
+    iterator begin() noexcept { return this->s; }
+    iterator end() noexcept { return this->s + N; }
+    const_iterator begin() const noexcept { return this->s; }
+    const_iterator end() const noexcept { return this->s + N; }
+
+    //==========================================================================
+
+    /**
+     * @brief Reads the `V::size` values starting at index `i`.
+     *
+     * @tparam V A `Vector` of `T`, e.g. `float_4`.
+     * @param i A multiple of `V::size`, at most `N - V::size`.
+     * @return V
+     */
+    template <typename V>
+    V load(::StoneyDSP::size_t i) const noexcept
+    {
+        return ::StoneyDSP::SIMD::PolyBuffer<T, N>::isAligned<V>()
+            ? V::loadAligned(this->s + i)
+            : V::load(this->s + i);
+    }
+
+    /**
+     * @brief Writes `v` to the `V::size` values starting at index `i`.
+     *
+     * @tparam V A `Vector` of `T`, e.g. `float_4`.
+     * @param i A multiple of `V::size`, at most `N - V::size`.
+     * @param v
+     */
+    template <typename V>
+    void store(::StoneyDSP::size_t i, V v) noexcept
+    {
+        if (::StoneyDSP::SIMD::PolyBuffer<T, N>::isAligned<V>()) {
+            v.storeAligned(this->s + i);
+        } else {
+            v.store(this->s + i);
+        }
+    }
+
+private:
+
+    /**
+     * @brief Whether a `V` at any multiple of `V::size` is aligned.
+     *
+     */
+    template <typename V>
+    static constexpr bool isAligned() noexcept
+    {
+        return sizeof(V) <= STONEYDSP_POLYBUFFER_ALIGNMENT;
+    }
+};
+
+//==============================================================================
+
+  /// @} group SIMD
+} // namespace SIMD
+
+//==============================================================================
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
+
+//==============================================================================
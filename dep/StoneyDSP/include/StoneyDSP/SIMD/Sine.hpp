@@ -0,0 +1,245 @@
+/***************************************************************************//**
+ * @file Sine.hpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief
+ * @version 0.0.0
+ * @date 2024-11-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * therights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/orsell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#pragma once
+
+#define STONEYDSP_SIMD_SINE_HPP_INCLUDED 1
+
+//==============================================================================
+
+#ifndef STONEYDSP_CORE_HPP_INCLUDED
+ #include "StoneyDSP/Core.hpp"
+#endif
+
+#ifndef STONEYDSP_SIMD_VECTOR_HPP_INCLUDED
+ #include "StoneyDSP/SIMD/Vector.hpp"
+#endif
+
+//==============================================================================
+
+/**
+ * @brief This file describes fast, branch-free sine and cosine approximations
+ * for `float`, `double`, `float_4` and `double_2`, for use where libm
+ * precision is not needed (e.g. LFOs and oscillator cores).
+ *
+ * The phase is folded into a triangle `t` in `[-1, 1]` such that
+ * `sin(2 * pi * phase) == sin(pi / 2 * t)`, which is then approximated by an
+ * odd minimax polynomial. The degree of the polynomial is selected by a
+ * `SineAccuracy` tier; the maximum absolute error of each tier is:
+ *
+ * - `SineAccuracy::Low` - degree 5, `6.8e-5` (about -83dB)
+ * - `SineAccuracy::Medium` - degree 7, `5.9e-7` (about -124dB)
+ * - `SineAccuracy::High` - degree 9, `3.4e-9` (below `float` precision)
+ *
+ * @example
+ * ```cpp
+ * ::StoneyDSP::SIMD::float_4 phase {0.0F, 0.25F, 0.5F, 0.75F};
+ * ::StoneyDSP::SIMD::float_4 y = ::StoneyDSP::SIMD::sin2pi(phase); // {0, 1, 0, -1}
+ * ```
+ */
+
+//==============================================================================
+
+namespace StoneyDSP {
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+//==============================================================================
+
+namespace SIMD {
+/** @addtogroup SIMD
+ *  @{
+ */
+
+//==============================================================================
+
+/**
+ * @brief The accuracy tiers of the sine approximations.
+ *
+ */
+enum class SineAccuracy {
+    /** Degree 5, max. error `6.8e-5`. */
+    Low,
+    /** Degree 7, max. error `5.9e-7`. */
+    Medium,
+    /** Degree 9, max. error `3.4e-9`. */
+    High
+};
+
+//==============================================================================
+
+/**
+ * @brief The odd minimax polynomials approximating `sin(pi / 2 * t)` for `t`
+ * in `[-1, 1]`, one per `SineAccuracy` tier.
+ *
+ * @tparam T `float`, `double`, `float_4` or `double_2`.
+ * @tparam A The accuracy tier.
+ */
+template <typename T, ::StoneyDSP::SIMD::SineAccuracy A>
+struct SinePolynomial;
+
+template <typename T>
+struct SinePolynomial<T, ::StoneyDSP::SIMD::SineAccuracy::Low>
+{
+    static T process(const T& t) noexcept
+    {
+        const T t2 = t * t;
+        return t * (static_cast<T>(1.5703200191598750) +
+               t2 * (static_cast<T>(-0.64211316701052179) +
+               t2 *  static_cast<T>(0.071860854251549477)));
+    }
+};
+
+template <typename T>
+struct SinePolynomial<T, ::StoneyDSP::SIMD::SineAccuracy::Medium>
+{
+    static T process(const T& t) noexcept
+    {
+        const T t2 = t * t;
+        return t * (static_cast<T>(1.5707910110756262) +
+               t2 * (static_cast<T>(-0.64589284954879100) +
+               t2 * (static_cast<T>(0.079434344617870481) +
+               t2 *  static_cast<T>(-0.0043330952931384123))));
+    }
+};
+
+template <typename T>
+struct SinePolynomial<T, ::StoneyDSP::SIMD::SineAccuracy::High>
+{
+    static T process(const T& t) noexcept
+    {
+        const T t2 = t * t;
+        return t * (static_cast<T>(1.5707962900223709) +
+               t2 * (static_cast<T>(-0.64596335986590014) +
+               t2 * (static_cast<T>(0.079688480540372128) +
+               t2 * (static_cast<T>(-0.0046722279232998681) +
+               t2 *  static_cast<T>(0.00015082056456927598)))));
+    }
+};
+
+//==============================================================================
+
+/**
+ * @brief Folds a normalized phase (in cycles) into the triangle `t` in
+ * `[-1, 1]`, such that `sin(2 * pi * phase) == sin(pi / 2 * t)`.
+ * `t` rises from `0` at `phase == 0`, like the sine.
+ *
+ * @param phase Any phase; only its fractional part is used.
+ * @return T
+ */
+template <typename T>
+inline T foldPhase(const T& phase) noexcept
+{
+    T t = phase + static_cast<T>(0.25);
+    t -= ::StoneyDSP::SIMD::floor(t);
+    return static_cast<T>(1.0) - static_cast<T>(4.0) * ::StoneyDSP::SIMD::fabs(t - static_cast<T>(0.5));
+}
+
+/**
+ * @brief Returns `sin(pi / 2 * t)` for `t` in `[-1, 1]`, i.e. the sine of a
+ * phase that has already been folded by `foldPhase()`.
+ *
+ * @tparam A The accuracy tier.
+ * @param t
+ * @return T
+ */
+template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium, typename T>
+inline T sinFolded(const T& t) noexcept
+{
+    return ::StoneyDSP::SIMD::SinePolynomial<T, A>::process(t);
+}
+
+/**
+ * @brief Returns `sin(2 * pi * phase)`, where `phase` is in cycles.
+ *
+ * @tparam A The accuracy tier.
+ * @param phase
+ * @return T
+ */
+template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium, typename T>
+inline T sin2pi(const T& phase) noexcept
+{
+    return ::StoneyDSP::SIMD::sinFolded<A>(::StoneyDSP::SIMD::foldPhase(phase));
+}
+
+/**
+ * @brief Returns `sin(x)`, where `x` is in radians.
+ *
+ * @tparam A The accuracy tier.
+ * @param x
+ * @return T
+ */
+template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium, typename T>
+inline T sin(const T& x) noexcept
+{
+    return ::StoneyDSP::SIMD::sin2pi<A>(x * static_cast<T>(0.15915494309189535));
+}
+
+/**
+ * @brief Returns `cos(2 * pi * phase)`, where `phase` is in cycles.
+ *
+ * @tparam A The accuracy tier.
+ * @param phase
+ * @return T
+ */
+template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium, typename T>
+inline T cos2pi(const T& phase) noexcept
+{
+    return ::StoneyDSP::SIMD::sin2pi<A>(phase + static_cast<T>(0.25));
+}
+
+/**
+ * @brief Returns `cos(x)`, where `x` is in radians.
+ *
+ * @tparam A The accuracy tier.
+ * @param x
+ * @return T
+ */
+template <::StoneyDSP::SIMD::SineAccuracy A = ::StoneyDSP::SIMD::SineAccuracy::Medium, typename T>
+inline T cos(const T& x) noexcept
+{
+    return ::StoneyDSP::SIMD::cos2pi<A>(x * static_cast<T>(0.15915494309189535));
+}
+
+//==============================================================================
+
+  /// @} group SIMD
+} // namespace SIMD
+
+//==============================================================================
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
+
+//==============================================================================
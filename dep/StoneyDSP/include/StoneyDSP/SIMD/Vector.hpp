@@ -43,6 +43,10 @@
 
 //==============================================================================
 
+#include <cmath>
+
+//==============================================================================
+
 /**
  * @brief This file describes the data types for using SIMD instructions to
  * "vectorize" some operations. It uses parallel CPU processing to optimize
@@ -56,6 +60,12 @@
  * - `int32_4` - 4x32-bit integer
  * - `int64_2` - 2x64-bit integer
  *
+ * When `STONEYDSP_USING_AVX` is set (i.e. the compiler targets AVX), the
+ * following 256-bit types are also available:
+ *
+ * - `double_4` - 4x64-bit double-precision
+ * - `float_8` - 8x32-bit floating point
+ *
  * The file has the below requirements, which are imported in `common.hpp` as
  * shown using the below pre-processor logic:
  * @example
@@ -141,6 +151,27 @@ using float_t = ::StoneyDSP::SIMD::__FLOAT_T;
  */
 using int_t = ::StoneyDSP::SIMD::__INT_T;
 
+#if STONEYDSP_USING_AVX
+
+using __DOUBLE256_T = __m256d;
+using __FLOAT256_T = __m256;
+
+/**
+ * @brief A 256-bit register of four double-precision floating point numbers
+ * `(4x64 = 256 bits)`. Requires AVX.
+ *
+ */
+using double256_t = ::StoneyDSP::SIMD::__DOUBLE256_T;
+
+/**
+ * @brief A 256-bit register of eight single-precision floating point numbers
+ * `(8x32 = 256 bits)`. Requires AVX.
+ *
+ */
+using float256_t = ::StoneyDSP::SIMD::__FLOAT256_T;
+
+#endif
+
 // not supported on ARM....
 
 // /**
@@ -233,6 +264,28 @@ struct Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>;
 
 #endif
 
+#if STONEYDSP_USING_AVX
+
+/**
+ * @brief A `Vector` of four double-precision floating point numbers
+ * `(4x64 = 256 bits)`. Requires AVX.
+ *
+ * @tparam
+ */
+template <>
+struct Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>;
+
+/**
+ * @brief A `Vector` of eight single-precision floating point numbers
+ * `(8x32 = 256 bits)`. Requires AVX.
+ *
+ * @tparam
+ */
+template <>
+struct Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>;
+
+#endif
+
 //==============================================================================
 
 /**
@@ -273,6 +326,20 @@ using int32_4 = Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>;
 using int64_2 = Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>;
 #endif
 
+#if STONEYDSP_USING_AVX
+/**
+ * @brief An array of four 64-bit double precision values.
+ *
+ */
+using double_4 = Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>;
+
+/**
+ * @brief An array of eight 32-bit floating point values.
+ *
+ */
+using float_8 = Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>;
+#endif
+
 //==============================================================================
 
 template <>
@@ -370,6 +437,27 @@ public:
 		_mm_storeu_pd(x, v);
 	}
 
+    /**
+     * @brief As `load()`, but `x` must be aligned to 16 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+     * @param x
+     * @return `Vector<double, 2>`
+     */
+	static Vector loadAligned(const ::StoneyDSP::double_t* x) {
+		return Vector(_mm_load_pd(x));
+	}
+
+	/**
+	 * @brief As `store()`, but `x` must be aligned to 16 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+	 * @param x
+	 */
+	void storeAligned(::StoneyDSP::double_t* x) {
+		_mm_store_pd(x, v);
+	}
+
     //==========================================================================
 
     /**
@@ -428,12 +516,25 @@ public:
     // Conversions =============================================================
 
     Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a);
+
+    /**
+     * @brief Converts elements `2..3` of a `Vector<float, 4>`; the
+     * conversion constructor converts elements `0..1`.
+     *
+     * @param a
+     * @return `Vector<double, 2>`
+     */
+    static Vector convertHigh(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a);
     Vector(Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a);
     Vector(Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a);
 	Vector(Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a);
 #if STONEYDSP_USING_INT64_2
     Vector(Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a);
 #endif
+#if STONEYDSP_USING_AVX
+    Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a);
+    Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a);
+#endif
 
 	// Casts ===================================================================
 
@@ -557,6 +658,27 @@ public:
 		_mm_storeu_ps(x, v);
 	}
 
+    /**
+     * @brief As `load()`, but `x` must be aligned to 16 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+     * @param x
+     * @return `Vector<float, 4>`
+     */
+	static Vector loadAligned(const ::StoneyDSP::float_t *x) {
+		return Vector(_mm_load_ps(x));
+	}
+
+	/**
+	 * @brief As `store()`, but `x` must be aligned to 16 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+	 * @param x
+	 */
+	void storeAligned(::StoneyDSP::float_t *x) {
+		_mm_store_ps(x, v);
+	}
+
     //==========================================================================
 
     /**
@@ -615,12 +737,28 @@ public:
     // Conversions =============================================================
 
     Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a);
+
+	/**
+	 * @brief Constructs a `Vector<float, 4>` from two `Vector<double, 2>`;
+	 * `lo` fills elements `0..1`, and `hi` fills elements `2..3`.
+	 *
+	 * @param lo
+	 * @param hi
+	 */
+	Vector(
+        Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> lo,
+        Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> hi
+    );
     Vector(Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a);
     Vector(Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a);
 	Vector(Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a);
 #if STONEYDSP_USING_INT64_2
     Vector(Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a);
 #endif
+#if STONEYDSP_USING_AVX
+    Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a);
+    Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a);
+#endif
 
 	// Casts ===================================================================
 
@@ -1444,543 +1582,1990 @@ private:
 
 #endif
 
-// Conversions - double_2 ======================================================
-
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvtps_pd(a.v);
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
-{
-	v = _mm_cvtepi32_pd(a.v);
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
-{
-	v = _mm_cvtepi32_pd(a.v);
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvtepi32_pd(a.v);
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvtepi32_pd(a.v);
-}
-#endif
+#if STONEYDSP_USING_AVX
 
-// Conversions - float_4 =======================================================
+//==============================================================================
 
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvtpd_ps(a.v);
-}
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
-{
-	v = _mm_cvtepi32_ps(a.v);
-}
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
-{
-	v = _mm_cvtepi32_ps(a.v);
-}
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvtepi32_ps(a.v);
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvtepi32_ps(a.v);
-}
-#endif
+template <>
+struct Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> {
+public:
 
-// Conversions - int8_16 =======================================================
+	using type = ::StoneyDSP::double_t;
 
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvttpd_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvttps_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
-{
-	v = a.v;
-}
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16>::Vector(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = a.v;
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = a.v;
-}
-#endif
+    /**
+     * @brief The number of scalars contained by this `Vector`.
+     */
+    constexpr static ::StoneyDSP::size_t size = 4U;
 
-// Conversions - int16_8 =======================================================
+    union {
+        /**
+         * @brief
+         */
+		::StoneyDSP::SIMD::double256_t v;
 
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvttpd_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvttps_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
-{
-	v = a.v;
-}
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = a.v;
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = a.v;
-}
-#endif
+        /**
+         * @warning Accessing this array of scalars is slow and defeats the
+         * purpose of vectorizing.
+		 */
+		::StoneyDSP::double_t s[4];
+	};
 
-// Conversions - int32_4 =======================================================
+    //==========================================================================
 
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = _mm_cvttpd_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
-{
-	v = _mm_cvttps_epi32(a.v);
-}
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
-{
-	v = a.v;
-}
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
-{
-	v = a.v;
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
-{
-	v = a.v;
-}
-#endif
+    /**
+     * @brief Constructs an uninitialized `Vector<double, 4>`.
+     *
+     */
+	Vector() = default;
 
-// Conversions - int64_2 =======================================================
+    /**
+     * @brief Constructs a `Vector<double, 4>` from a `Vector<double, 4>`.
+     *
+     * @param v
+     */
+	Vector(::StoneyDSP::SIMD::double256_t v) : v(v) {}
 
-#if STONEYDSP_USING_INT64_2
+    /**
+     * @brief Constructs a `Vector<double, 4>` with all elements set to `x`.
+     *
+     * @param x
+     */
+	Vector(::StoneyDSP::double_t x) {
+		v = _mm256_set1_pd(x);
+	}
 
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+	/**
+	 * @brief Constructs a `Vector<double, 4>` from four scalars.
+	 *
+	 * @param x1
+	 * @param x2
+	 * @param x3
+	 * @param x4
+	 */
+	Vector(
+        ::StoneyDSP::double_t x1,
+        ::StoneyDSP::double_t x2,
+        ::StoneyDSP::double_t x3,
+        ::StoneyDSP::double_t x4
+    ) {
+		v = _mm256_setr_pd(x1, x2, x3, x4);
+	}
+
+    //==========================================================================
+
+    /**
+     * @brief Reads from a `double_4` (an array of four 64-bit
+     * double-precision values).
+     *
+     * @param x
+     * @return `Vector<double, 4>`
+     */
+	static Vector load(const ::StoneyDSP::double_t* x) {
+		return Vector(_mm256_loadu_pd(x));
+	}
+
+	/**
+	 * @brief Writes to a `double_4` (an array of four 64-bit double-precision
+     * values).
+     *
+	 * @param x
+	 */
+	void store(::StoneyDSP::double_t* x) {
+		_mm256_storeu_pd(x, v);
+	}
+
+    /**
+     * @brief As `load()`, but `x` must be aligned to 32 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+     * @param x
+     * @return `Vector<double, 4>`
+     */
+	static Vector loadAligned(const ::StoneyDSP::double_t* x) {
+		return Vector(_mm256_load_pd(x));
+	}
+
+	/**
+	 * @brief As `store()`, but `x` must be aligned to 32 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+	 * @param x
+	 */
+	void storeAligned(::StoneyDSP::double_t* x) {
+		_mm256_store_pd(x, v);
+	}
+
+    //==========================================================================
+
+    /**
+     * @brief Returns a `double_4` with all bits set to `0`.
+     *
+     * @return `Vector<double, 4>`
+     */
+	static Vector zero() {
+		return Vector(_mm256_setzero_pd());
+	}
+
+    /**
+     * @brief Returns a `double_4` with all bits set to `1`.
+     *
+     * @return `Vector<double, 4>`
+     */
+	static Vector mask() {
+		return Vector(
+            _mm256_castsi256_pd(
+                _mm256_set1_epi64x(-1)
+            )
+        );
+	}
+
+    //==========================================================================
+
+    /**
+     * @warning Accessing vector elements individually is slow and defeats the
+     * purpose of vectorizing.
+     * However, this operator is convenient when writing simple serial code in
+     * a non-bottlenecked section.
+     *
+     * @param i
+     * @return double&
+     */
+	::StoneyDSP::double_t& operator[](::StoneyDSP::size_t i) {
+		return s[i];
+	}
+
+    /**
+     * @warning Accessing vector elements individually is slow and defeats the
+     * purpose of vectorizing.
+     * However, this operator is convenient when writing simple serial code in
+     * a non-bottlenecked section.
+     *
+     * @param i
+     * @return const double&
+     */
+	const ::StoneyDSP::double_t& operator[](::StoneyDSP::size_t i) const {
+		return s[i];
+	}
+
+    // Conversions =============================================================
+
+    Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a);
+    Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a);
+    Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a);
+
+	// Casts ===================================================================
+
+    static Vector cast(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a);
+
+    //==========================================================================
+
+private:
+
+    STONEYDSP_PREVENT_HEAP_ALLOCATION
+
+};
+
+//==============================================================================
+
+template <>
+struct Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> {
+public:
+
+	using type = ::StoneyDSP::float_t;
+
+    /**
+     * @brief The number of scalars contained by this `Vector`.
+     */
+    constexpr static ::StoneyDSP::size_t size = 8U;
+
+    union {
+        /**
+         * @brief
+         */
+		::StoneyDSP::SIMD::float256_t v;
+
+        /**
+         * @warning Accessing this array of scalars is slow and defeats the
+         * purpose of vectorizing.
+		 */
+		::StoneyDSP::float_t s[8];
+	};
+
+    //==========================================================================
+
+    /**
+     * @brief Constructs an uninitialized `Vector<float_t, 8>`.
+     *
+     */
+	Vector() = default;
+
+	/**
+	 * @brief Constructs a `Vector<float_t, 8>` from a `Vector<float_t, 8>`.
+	 *
+	 * @param v
+	 */
+	Vector(::StoneyDSP::SIMD::float256_t v) : v(v) {}
+
+    /**
+     * @brief Constructs a `Vector<float, 8>` with all elements set to `x`.
+     *
+     * @param x
+     */
+	Vector(::StoneyDSP::float_t x) {
+		v = _mm256_set1_ps(x);
+	}
+
+	/**
+	 * @brief Constructs a `Vector<float, 8>` from eight scalars.
+	 *
+	 * @param x1
+	 * @param x2
+	 * @param x3
+	 * @param x4
+	 * @param x5
+	 * @param x6
+	 * @param x7
+	 * @param x8
+	 */
+	Vector(
+        ::StoneyDSP::float_t x1,
+        ::StoneyDSP::float_t x2,
+        ::StoneyDSP::float_t x3,
+        ::StoneyDSP::float_t x4,
+        ::StoneyDSP::float_t x5,
+        ::StoneyDSP::float_t x6,
+        ::StoneyDSP::float_t x7,
+        ::StoneyDSP::float_t x8
+    ) {
+		v = _mm256_setr_ps(x1, x2, x3, x4, x5, x6, x7, x8);
+	}
+
+	/**
+	 * @brief Constructs a `Vector<float, 8>` from two `Vector<float, 4>`;
+	 * `lo` fills elements `0..3`, and `hi` fills elements `4..7`.
+	 *
+	 * @param lo
+	 * @param hi
+	 */
+	Vector(
+        Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> lo,
+        Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> hi
+    );
+
+    //==========================================================================
+
+    /**
+     * @brief Reads from a `float_8` (an array of eight 32-bit floating-point
+     * values).
+     *
+     * @param x
+     * @return `Vector<float, 8>`
+     */
+	static Vector load(const ::StoneyDSP::float_t *x) {
+		return Vector(_mm256_loadu_ps(x));
+	}
+
+	/**
+	 * @brief Writes to a `float_8` (an array of eight 32-bit floating-point
+     * values).
+     *
+	 * @param x
+	 */
+	void store(::StoneyDSP::float_t *x) {
+		_mm256_storeu_ps(x, v);
+	}
+
+    /**
+     * @brief As `load()`, but `x` must be aligned to 32 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+     * @param x
+     * @return `Vector<float, 8>`
+     */
+	static Vector loadAligned(const ::StoneyDSP::float_t *x) {
+		return Vector(_mm256_load_ps(x));
+	}
+
+	/**
+	 * @brief As `store()`, but `x` must be aligned to 32 bytes (e.g. point
+     * into a `PolyBuffer`).
+     *
+	 * @param x
+	 */
+	void storeAligned(::StoneyDSP::float_t *x) {
+		_mm256_store_ps(x, v);
+	}
+
+    //==========================================================================
+
+    /**
+     * @brief Returns a `float_8` with all bits set to `0`.
+     *
+     * @return `Vector<float, 8>`
+     */
+	static Vector zero() {
+		return Vector(_mm256_setzero_ps());
+	}
+
+    /**
+     * @brief Returns a `float_8` with all bits set to `1`.
+     *
+     * @return `Vector<float, 8>`
+     */
+	static Vector mask() {
+		return Vector(
+            _mm256_castsi256_ps(
+                _mm256_set1_epi32(-1)
+            )
+        );
+	}
+
+    //==========================================================================
+
+    /**
+     * @warning Accessing vector elements individually is slow and defeats the
+     * purpose of vectorizing.
+     * However, this operator is convenient when writing simple serial code in
+     * a non-bottlenecked section.
+     *
+     * @param i
+     * @return float&
+     */
+	::StoneyDSP::float_t& operator[](::StoneyDSP::size_t i) {
+		return s[i];
+	}
+
+    /**
+     * @warning Accessing vector elements individually is slow and defeats the
+     * purpose of vectorizing.
+     * However, this operator is convenient when writing simple serial code in
+     * a non-bottlenecked section.
+     *
+     * @param i
+     * @return const float&
+     */
+	const ::StoneyDSP::float_t& operator[](::StoneyDSP::size_t i) const {
+		return s[i];
+	}
+
+    // Conversions =============================================================
+
+    Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a);
+    Vector(Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a);
+    Vector(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a);
+
+	// Casts ===================================================================
+
+    static Vector cast(Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a);
+
+    //==========================================================================
+
+private:
+
+    STONEYDSP_PREVENT_HEAP_ALLOCATION
+
+};
+
+#endif
+
+// Conversions - double_2 ======================================================
+
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvtps_pd(a.v);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::convertHigh(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_cvtps_pd(_mm_movehl_ps(a.v, a.v)));
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	v = _mm_cvtepi32_pd(a.v);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = _mm_cvtepi32_pd(a.v);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvtepi32_pd(a.v);
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvtepi32_pd(a.v);
+}
+#endif
+
+// Conversions - float_4 =======================================================
+
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvtpd_ps(a.v);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> lo,
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> hi)
+{
+	v = _mm_movelh_ps(_mm_cvtpd_ps(lo.v), _mm_cvtpd_ps(hi.v));
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	v = _mm_cvtepi32_ps(a.v);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = _mm_cvtepi32_ps(a.v);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvtepi32_ps(a.v);
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvtepi32_ps(a.v);
+}
+#endif
+
+// Conversions - int8_16 =======================================================
+
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvttpd_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvttps_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = a.v;
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16>::Vector(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = a.v;
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::Vector(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = a.v;
+}
+#endif
+
+// Conversions - int16_8 =======================================================
+
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvttpd_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvttps_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	v = a.v;
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = a.v;
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = a.v;
+}
+#endif
+
+// Conversions - int32_4 =======================================================
+
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvttpd_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvttps_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	v = a.v;
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = a.v;
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = a.v;
+}
+#endif
+
+// Conversions - int64_2 =======================================================
+
+#if STONEYDSP_USING_INT64_2
+
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm_cvttpd_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm_cvttps_epi32(a.v);
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	v = a.v;
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = a.v;
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = a.v;
+}
+
+#endif
+
+// Casts - double_2 ============================================================
+
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castps_pd(a.v));
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	return Vector(_mm_castsi128_pd(a.v));
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(_mm_castsi128_pd(a.v));
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castsi128_pd(a.v));
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castsi128_pd(a.v));
+}
+#endif
+
+// Casts - float_4 =============================================================
+
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castpd_ps(a.v));
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	return Vector(_mm_castsi128_ps(a.v));
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(_mm_castsi128_ps(a.v));
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castsi128_ps(a.v));
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castsi128_ps(a.v));
+}
+#endif
+
+// Casts - int8_16 =============================================================
+
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castpd_si128(a.v));
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castps_si128(a.v));
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(a.v);
+}
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(a.v);
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(a.v);
+}
+#endif
+
+// Casts - int16_8 =============================================================
+
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castpd_si128(a.v));
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castps_si128(a.v));
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	return Vector(a.v);
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(a.v);
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(a.v);
+}
+#endif
+
+// Casts - int32_4 =============================================================
+
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castpd_si128(a.v));
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castps_si128(a.v));
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	return Vector(a.v);
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(a.v);
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(a.v);
+}
+#endif
+
+// Casts - int64_2 =============================================================
+
+#if STONEYDSP_USING_INT64_2
+
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	return Vector(_mm_castpd_si128(a.v));
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm_castps_si128(a.v));
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+{
+	return Vector(a.v);
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(a.v);
+}
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a) {
+	return Vector(a.v);
+}
+
+#endif
+
+#if STONEYDSP_USING_AVX
+
+// Conversions - 256-bit to 128-bit ============================================
+
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm256_castpd256_pd128(a.v);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = _mm_cvtps_pd(_mm256_castps256_ps128(a.v));
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm256_cvtpd_ps(a.v);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = _mm256_castps256_ps128(a.v);
+}
+
+// Conversions - double_4 ======================================================
+
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+{
+	v = _mm256_insertf128_pd(_mm256_setzero_pd(), a.v, 0);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm256_cvtps_pd(a.v);
+}
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a)
+{
+	v = _mm256_cvtps_pd(_mm256_castps256_ps128(a.v));
+}
+
+// Conversions - float_8 =======================================================
+
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> lo,
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> hi)
+{
+	v = _mm256_insertf128_ps(_mm256_castps128_ps256(lo.v), hi.v, 1);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::Vector(
     Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
 {
-	v = _mm_cvttpd_epi32(a.v);
+	v = _mm256_insertf128_ps(_mm256_setzero_ps(), _mm_cvtpd_ps(a.v), 0);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm256_insertf128_ps(_mm256_setzero_ps(), a.v, 0);
+}
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::Vector(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a)
+{
+	v = _mm256_insertf128_ps(_mm256_setzero_ps(), _mm256_cvtpd_ps(a.v), 0);
+}
+
+// Casts - double_4 ============================================================
+
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>::cast(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> a)
+{
+	return Vector(_mm256_castps_pd(a.v));
+}
+
+// Casts - float_8 =============================================================
+
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::cast(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> a)
+{
+	return Vector(_mm256_castpd_ps(a.v));
+}
+
+#endif
+
+// Operator overloads ==========================================================
+
+/**
+ * @brief `a @ b`
+ *
+*/
+#define DECLARE_VECTOR_OPERATOR_INFIX(t, s, operator, func) \
+	inline Vector<t, s> operator(const Vector<t, s>& a, const Vector<t, s>& b) { \
+		return Vector<t, s>(func(a.v, b.v)); \
+	}
+
+/**
+ * @brief `a @= b`
+ *
+*/
+#define DECLARE_VECTOR_OPERATOR_INCREMENT(t, s, operator, opfunc) \
+	inline Vector<t, s>& operator(Vector<t, s>& a, const Vector<t, s>& b) { \
+		return a = opfunc(a, b); \
+	}
+
+//==============================================================================
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator+, _mm_add_pd)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator-, _mm_sub_pd)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator*, _mm_mul_pd)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator/, _mm_div_pd)
+
+//==============================================================================
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator+, _mm_add_ps)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator-, _mm_sub_ps)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator*, _mm_mul_ps)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator/, _mm_div_ps)
+
+//==============================================================================
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int8_t, 16>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator+, _mm_add_epi8)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int8_t, 16>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator-, _mm_sub_epi8)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator*, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator/, NOT AVAILABLE IN SSE3)
+
+//==============================================================================
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int16_t, 8>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator+, _mm_add_epi16)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int16_t, 8>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator-, _mm_sub_epi16)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator*, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator/, NOT AVAILABLE IN SSE3)
+
+//==============================================================================
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int32_t, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator+, _mm_add_epi32)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int32_t, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator-, _mm_sub_epi32)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator*, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator/, NOT AVAILABLE IN SSE3)
+
+//==============================================================================
+
+#if STONEYDSP_USING_INT64_2
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int64_t, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator+, _mm_add_epi64)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int64_t, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator-, _mm_sub_epi64)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator*, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator/, NOT AVAILABLE IN SSE3)
+
+#endif
+
+//==============================================================================
+
+/* Use these to apply logic, bit masks, and conditions to elements.
+Boolean operators on vectors give 0x00000000 for false and 0xffffffff for true, for each vector element.
+
+Examples:
+
+Subtract 1 from value if greater than or equal to 1.
+
+	x -= (x >= 1.f) & 1.f;
+*/
+
+//==============================================================================
+
+// ^
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator^, _mm_xor_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator^, _mm_xor_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator^, _mm_xor_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator^, _mm_xor_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator^, _mm_xor_si128)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator^, _mm_xor_si128)
+#endif
+
+//==============================================================================
+
+// &
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator&, _mm_and_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator&, _mm_and_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator&, _mm_and_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator&, _mm_and_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator&, _mm_and_si128)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator&, _mm_and_si128)
+#endif
+
+//==============================================================================
+
+// |
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator|, _mm_or_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator|, _mm_or_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator|, _mm_or_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator|, _mm_or_si128)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator|, _mm_or_si128)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator|, _mm_or_si128)
+#endif
+
+//==============================================================================
+
+// +=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator+=, operator+)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator+=, operator+)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator+=, operator+)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator+=, operator+)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator+=, operator+)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator+=, operator+)
+#endif
+
+//==============================================================================
+
+// -=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator-=, operator-)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator-=, operator-)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator-=, operator-)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator-=, operator-)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator-=, operator-)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator-=, operator-)
+#endif
+
+//==============================================================================
+
+// *=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator*=, operator*)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator*=, operator*)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator*=, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator*=, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator*=, NOT AVAILABLE IN SSE3)
+#if STONEYDSP_USING_INT64_2
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator*=, NOT AVAILABLE IN SSE3)
+#endif
+
+//==============================================================================
+
+// /=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator/=, operator/)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator/=, operator/)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator/=, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator/=, NOT AVAILABLE IN SSE3)
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator/=, NOT AVAILABLE IN SSE3)
+#if STONEYDSP_USING_INT64_2
+// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator/=, NOT AVAILABLE IN SSE3)
+#endif
+
+//==============================================================================
+
+// ^⁼
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator^=, operator^)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator^=, operator^)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator^=, operator^)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator^=, operator^)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator^=, operator^)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator^=, operator^)
+#endif
+
+//==============================================================================
+
+// &=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator&=, operator&)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator&=, operator&)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator&=, operator&)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator&=, operator&)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator&=, operator&)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator&=, operator&)
+#endif
+
+//==============================================================================
+
+// |=
+
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator|=, operator|)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator|=, operator|)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator|=, operator|)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator|=, operator|)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator|=, operator|)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator|=, operator|)
+#endif
+
+//==============================================================================
+
+// >=
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator>=, _mm_cmpge_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator>=, _mm_cmpge_ps)
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator>=(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
+{
+	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmpgt_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator>=(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
 {
-	v = _mm_cvttps_epi32(a.v);
+	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmpgt_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator>=(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
+{
+	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmpgt_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
+}
+#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator>=(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b)
+{
+	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmpgt_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
+}
+#endif
+
+//==============================================================================
+
+// >
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator>, _mm_cmpgt_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator>, _mm_cmpgt_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator>, _mm_cmpgt_epi8)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator>, _mm_cmpgt_epi16)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator>, _mm_cmpgt_epi32)
+#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator>, _mm_cmpgt_epi64)
+#endif
+
+//==============================================================================
+
+// <=
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator<=, _mm_cmple_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator<=, _mm_cmple_ps)
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator<=(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
+{
+	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmplt_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
+}
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator<=(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
+{
+	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmplt_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
+}
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator<=(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
+{
+	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmplt_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
+}
+#if STONEYDSP_USING_INT64_2
+// inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator<=(const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b) {
+// 	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmplt_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
+// }
+#endif
+
+//==============================================================================
+
+// <
+
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator<, _mm_cmplt_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator<, _mm_cmplt_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator<, _mm_cmplt_epi8)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator<, _mm_cmplt_epi16)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator<, _mm_cmplt_epi32)
+#if STONEYDSP_USING_INT64_2
+// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator<, _mm_cmplt_epi64)
+#endif
+
+//==============================================================================
+
+// !=
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator!=, _mm_cmpneq_pd)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator!=, _mm_cmpneq_ps)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int8_t, 16>
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator!=(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
+{
+	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmpeq_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, 16U>::mask();
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int16_t, 8>
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator!=(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
 {
-	v = a.v;
+	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmpeq_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int32_t, 4>
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator!=(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
 {
-	v = a.v;
+	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmpeq_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::Vector(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+
+#if STONEYDSP_USING_INT64_2
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int64_t, 2>
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator!=(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b)
 {
-	v = a.v;
+	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmpeq_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
 }
 
 #endif
 
-// Casts - double_2 ============================================================
+//==============================================================================
 
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
-{
-	return Vector(_mm_castps_pd(a.v));
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
-{
-	return Vector(_mm_castsi128_pd(a.v));
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
-{
-	return Vector(_mm_castsi128_pd(a.v));
-}
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
-{
-	return Vector(_mm_castsi128_pd(a.v));
-}
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+// +a
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator+(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(_mm_castsi128_pd(a.v));
+	return a;
 }
-#endif
-
-// Casts - float_4 =============================================================
 
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator+(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(_mm_castpd_ps(a.v));
+	return a;
 }
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int8_t, 16>
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator+(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
 {
-	return Vector(_mm_castsi128_ps(a.v));
+	return a;
 }
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int16_t, 8>
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator+(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
 {
-	return Vector(_mm_castsi128_ps(a.v));
+	return a;
 }
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int32_t, 4>
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator+(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(_mm_castsi128_ps(a.v));
+	return a;
 }
+
 #if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int64_t, 2>
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator+(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(_mm_castsi128_ps(a.v));
+	return a;
 }
+
 #endif
 
-// Casts - int8_16 =============================================================
+//==============================================================================
 
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+// -a
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator-(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(_mm_castpd_si128(a.v));
+	return (::StoneyDSP::double_t)0.0 - a;
 }
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator-(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(_mm_castps_si128(a.v));
+	return (::StoneyDSP::float_t)0.0f - a;
 }
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int8_t, 16>
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator-(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
 {
-	return Vector(a.v);
+	return (::StoneyDSP::int8_t)0 - a;
 }
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int16_t, 8>
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator-(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
 {
-	return Vector(a.v);
+	return (::StoneyDSP::int16_t)0 - a;
+}
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int32_t, 4>
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator-(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
+{
+	return (::StoneyDSP::int32_t)0 - a;
 }
+
 #if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::cast(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int64_t, 2>
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator-(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(a.v);
+	return _mm_castpd_si128(_mm_setzero_pd()) - a;
 }
+
 #endif
 
-// Casts - int16_8 =============================================================
+//==============================================================================
 
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+// ++a
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<double, 2>&
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& operator++(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
+{
+	return a += (::StoneyDSP::double_t)1.0;
+}
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<float, 4>&
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& operator++(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(_mm_castpd_si128(a.v));
+	return a += (::StoneyDSP::float_t)1.0f;
 }
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int8_t, 16>&
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& operator++(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
 {
-	return Vector(_mm_castps_si128(a.v));
+	return a += (::StoneyDSP::int8_t)1;
 }
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int16_t, 8>&
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& operator++(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
 {
-	return Vector(a.v);
+	return a += (::StoneyDSP::int16_t)1;
 }
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int32_t, 4>&
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& operator++(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(a.v);
+	return a += (::StoneyDSP::int32_t)1;
 }
+
 #if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::cast(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int64_t, 2>&
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& operator++(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(a.v);
+	return a += _mm_castpd_si128(_mm_set1_pd(1.0));
 }
+
 #endif
 
-// Casts - int32_4 =============================================================
+//==============================================================================
 
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+// --a
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<double, 2>&
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& operator--(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(_mm_castpd_si128(a.v));
+	return a -= (::StoneyDSP::double_t)1.0;
 }
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<float, 4>&
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& operator--(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
 {
-	return Vector(_mm_castps_si128(a.v));
+	return a -= (::StoneyDSP::float_t)1.0f;
 }
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int8_t, 16>&
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& operator--(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
 {
-	return Vector(a.v);
+	return a -= (::StoneyDSP::int8_t)1;
 }
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int16_t, 8>&
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& operator--(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
 {
-	return Vector(a.v);
+	return a -= (::StoneyDSP::int16_t)1;
+}
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int32_t, 4>&
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& operator--(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
+{
+	return a -= (::StoneyDSP::int32_t)1;
 }
+
 #if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::cast(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int64_t, 2>&
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& operator--(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
 {
-	return Vector(a.v);
+	return a -= _mm_castpd_si128(_mm_set1_pd(1.0));
 }
+
 #endif
 
-// Casts - int64_2 =============================================================
+//==============================================================================
 
-#if STONEYDSP_USING_INT64_2
+// a++
 
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> a)
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator++(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a, int)
 {
-	return Vector(_mm_castpd_si128(a.v));
+	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> b = a;
+	++a;
+	return b;
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator++(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a, int)
 {
-	return Vector(_mm_castps_si128(a.v));
+	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> b = a;
+	++a;
+	return b;
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int8_t, 16>
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator++(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a, int)
 {
-	return Vector(a.v);
+	Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> b = a;
+	++a;
+	return b;
 }
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> a)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @return Vector<int16_t, 8>
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator++(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a, int)
 {
-	return Vector(a.v);
-}
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::cast(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> a) {
-	return Vector(a.v);
+	Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> b = a;
+	++a;
+	return b;
 }
 
-#endif
-
-// Operator overloads ==========================================================
-
 /**
- * @brief `a @ b`
+ * @brief
  *
-*/
-#define DECLARE_VECTOR_OPERATOR_INFIX(t, s, operator, func) \
-	inline Vector<t, s> operator(const Vector<t, s>& a, const Vector<t, s>& b) { \
-		return Vector<t, s>(func(a.v, b.v)); \
-	}
+ * @param a
+ * @return Vector<int32_t, 4>
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator++(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a, int)
+{
+	Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> b = a;
+	++a;
+	return b;
+}
+
+#if STONEYDSP_USING_INT64_2
 
 /**
- * @brief `a @= b`
+ * @brief
  *
-*/
-#define DECLARE_VECTOR_OPERATOR_INCREMENT(t, s, operator, opfunc) \
-	inline Vector<t, s>& operator(Vector<t, s>& a, const Vector<t, s>& b) { \
-		return a = opfunc(a, b); \
-	}
+ * @param a
+ * @return Vector<int64_t, 2>
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator++(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, int)
+{
+	Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> b = a;
+	++a;
+	return b;
+}
+
+#endif
 
 //==============================================================================
 
+// a--
+
 /**
  * @brief
  *
  * @param a
- * @param b
  * @return Vector<double, 2>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator+, _mm_add_pd)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator--(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a, int)
+{
+	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> b = a;
+	--a;
+	return b;
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<double, 2>
+ * @return Vector<float, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator-, _mm_sub_pd)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator--(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a, int)
+{
+	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> b = a;
+	--a;
+	return b;
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<double, 2>
+ * @return Vector<int8_t, 16>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator*, _mm_mul_pd)
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator--(
+    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a, int)
+{
+	Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> b = a;
+	--a;
+	return b;
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<double, 2>
+ * @return Vector<int16_t, 8>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator/, _mm_div_pd)
-
-//==============================================================================
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator--(
+    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a, int)
+{
+	Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> b = a;
+	--a;
+	return b;
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<float, 4>
+ * @return Vector<int32_t, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator+, _mm_add_ps)
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator--(
+    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a, int)
+{
+	Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> b = a;
+	--a;
+	return b;
+}
+
+#if STONEYDSP_USING_INT64_2
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<float, 4>
+ * @return Vector<int64_t, 2>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator-, _mm_sub_ps)
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator--(
+    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, int)
+{
+	Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> b = a;
+	--a;
+	return b;
+}
+
+#endif
+
+//==============================================================================
+
+// ~a
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<float, 4>
+ * @return Vector<double, 2>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator*, _mm_mul_ps)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator~(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
+{
+	return a ^ Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::mask();
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
  * @return Vector<float, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator/, _mm_div_ps)
-
-//==============================================================================
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator~(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
+{
+	return a ^ Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::mask();
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
  * @return Vector<int8_t, 16>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator+, _mm_add_epi8)
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator~(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
+{
+	return a ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<int8_t, 16>
+ * @return Vector<int16_t, 8>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator-, _mm_sub_epi8)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator*, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator/, NOT AVAILABLE IN SSE3)
-
-//==============================================================================
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator~(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
+{
+	return a ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
+}
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<int16_t, 8>
+ * @return Vector<int32_t, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator+, _mm_add_epi16)
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator~(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
+{
+	return a ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
+}
+
+#if STONEYDSP_USING_INT64_2
 
 /**
  * @brief
  *
  * @param a
- * @param b
- * @return Vector<int16_t, 8>
+ * @return Vector<int64_t, 2>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator-, _mm_sub_epi16)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator*, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator/, NOT AVAILABLE IN SSE3)
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator~(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
+{
+	return a ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
+}
+
+#endif
 
 //==============================================================================
 
+// a << b
+
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int32_t, 4>
+ * @return Vector<int8_t, 16>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator+, _mm_add_epi32)
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator<<(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(
+        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int32_t, 4>
+ * @return Vector<int16_t, 8>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator-, _mm_sub_epi32)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator*, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator/, NOT AVAILABLE IN SSE3)
-
-//==============================================================================
-
-#if STONEYDSP_USING_INT64_2
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator<<(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(
+        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
 
 /**
+ *
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int64_t, 2>
+ * @return Vector<int32_t, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator+, _mm_add_epi64)
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator<<(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(
+        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
+
+#if STONEYDSP_USING_INT64_2
 
 /**
  * @brief
@@ -1989,780 +3574,788 @@ DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, ope
  * @param b
  * @return Vector<int64_t, 2>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator-, _mm_sub_epi64)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator*, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator/, NOT AVAILABLE IN SSE3)
-
-#endif
-
-//==============================================================================
-
-/* Use these to apply logic, bit masks, and conditions to elements.
-Boolean operators on vectors give 0x00000000 for false and 0xffffffff for true, for each vector element.
-
-Examples:
-
-Subtract 1 from value if greater than or equal to 1.
-
-	x -= (x >= 1.f) & 1.f;
-*/
-
-//==============================================================================
-
-// ^
-
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator^, _mm_xor_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator^, _mm_xor_ps)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator^, _mm_xor_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator^, _mm_xor_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator^, _mm_xor_si128)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator^, _mm_xor_si128)
-#endif
-
-//==============================================================================
-
-// &
-
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator&, _mm_and_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator&, _mm_and_ps)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator&, _mm_and_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator&, _mm_and_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator&, _mm_and_si128)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator&, _mm_and_si128)
-#endif
-
-//==============================================================================
-
-// |
-
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator|, _mm_or_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator|, _mm_or_ps)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator|, _mm_or_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator|, _mm_or_si128)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator|, _mm_or_si128)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator|, _mm_or_si128)
-#endif
-
-//==============================================================================
-
-// +=
-
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator+=, operator+)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator+=, operator+)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator+=, operator+)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator+=, operator+)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator+=, operator+)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator+=, operator+)
-#endif
-
-//==============================================================================
-
-// -=
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator<<(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(
+        _mm_sll_epi64(a.v, _mm_cvtsi64_si128(b))
+    );
+}
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator-=, operator-)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator-=, operator-)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator-=, operator-)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator-=, operator-)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator-=, operator-)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator-=, operator-)
 #endif
 
 //==============================================================================
 
-// *=
+// a >> b
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator*=, operator*)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator*=, operator*)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator*=, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator*=, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator*=, NOT AVAILABLE IN SSE3)
-#if STONEYDSP_USING_INT64_2
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator*=, NOT AVAILABLE IN SSE3)
-#endif
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int8_t, 16>
+ */
+inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator>>(
+    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(
+        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
 
-//==============================================================================
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int16_t, 8>
+ */
+inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator>>(
+    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(
+        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
 
-// /=
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int32_t, 4>
+ */
+inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator>>(
+    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(
+        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
+    );
+}
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator/=, operator/)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator/=, operator/)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator/=, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator/=, NOT AVAILABLE IN SSE3)
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator/=, NOT AVAILABLE IN SSE3)
 #if STONEYDSP_USING_INT64_2
-// DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator/=, NOT AVAILABLE IN SSE3)
-#endif
-
-//==============================================================================
 
-// ^⁼
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<int64_t, 2>
+ */
+inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator>>(
+    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
+    const int& b
+) {
+	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(
+        _mm_srl_epi64(a.v, _mm_cvtsi64_si128(b))
+    );
+}
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator^=, operator^)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator^=, operator^)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator^=, operator^)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator^=, operator^)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator^=, operator^)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator^=, operator^)
 #endif
 
 //==============================================================================
 
-// &=
+// fmin(a, b)
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator&=, operator&)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator&=, operator&)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator&=, operator&)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator&=, operator&)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator&=, operator&)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator&=, operator&)
-#endif
+/**
+ * @brief Returns the element-wise minimum of `a` and `b`.
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, fmin, _mm_min_pd)
+
+/**
+ * @brief Returns the element-wise minimum of `a` and `b`.
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, fmin, _mm_min_ps)
 
 //==============================================================================
 
-// |=
+// fmax(a, b)
 
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator|=, operator|)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator|=, operator|)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator|=, operator|)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator|=, operator|)
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator|=, operator|)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator|=, operator|)
-#endif
+/**
+ * @brief Returns the element-wise maximum of `a` and `b`.
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, fmax, _mm_max_pd)
+
+/**
+ * @brief Returns the element-wise maximum of `a` and `b`.
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, fmax, _mm_max_ps)
 
 //==============================================================================
 
-// >=
+// clamp(x, a, b)
 
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator>=, _mm_cmpge_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator>=, _mm_cmpge_ps)
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator>=(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
-{
-	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmpgt_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
-}
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator>=(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
-{
-	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmpgt_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
-}
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator>=(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
-{
-	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmpgt_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
+/**
+ * @brief Limits each element of `x` to the range `[a, b]`.
+ *
+ * @param x
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> clamp(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& x,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& b
+) {
+	return ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(x, a), b);
 }
-#if STONEYDSP_USING_INT64_2
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator>=(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b)
-{
-	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmpgt_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
+
+/**
+ * @brief Limits each element of `x` to the range `[a, b]`.
+ *
+ * @param x
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> clamp(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& x,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& b
+) {
+	return ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(x, a), b);
 }
-#endif
 
 //==============================================================================
 
-// >
+// floor(x)
 
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator>, _mm_cmpgt_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator>, _mm_cmpgt_ps)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator>, _mm_cmpgt_epi8)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator>, _mm_cmpgt_epi16)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator>, _mm_cmpgt_epi32)
-#if STONEYDSP_USING_INT64_2
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator>, _mm_cmpgt_epi64)
-#endif
+/**
+ * @brief Rounds each element of `x` towards negative infinity.
+ *
+ * @param x
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> floor(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& x
+) {
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>(_mm_floor_pd(x.v));
+}
+
+/**
+ * @brief Rounds each element of `x` towards negative infinity.
+ *
+ * @param x
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> floor(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& x
+) {
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>(_mm_floor_ps(x.v));
+}
 
 //==============================================================================
 
-// <=
+// fabs(x)
 
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator<=, _mm_cmple_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator<=, _mm_cmple_ps)
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator<=(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
-{
-	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmplt_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
-}
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator<=(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
-{
-	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmplt_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
+/**
+ * @brief Returns the absolute value of each element of `x`.
+ *
+ * @param x
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> fabs(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& x
+) {
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>(_mm_andnot_pd(_mm_set1_pd(-0.0), x.v));
 }
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator<=(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
-{
-	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmplt_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
+
+/**
+ * @brief Returns the absolute value of each element of `x`.
+ *
+ * @param x
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> fabs(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& x
+) {
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>(_mm_andnot_ps(_mm_set1_ps(-0.0F), x.v));
 }
-#if STONEYDSP_USING_INT64_2
-// inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator<=(const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b) {
-// 	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmplt_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
-// }
-#endif
 
 //==============================================================================
 
-// <
+// ifelse(mask, a, b)
+
+/**
+ * @brief Selects, per element, `a` where `mask` is set and `b` elsewhere.
+ * `mask` is the result of a comparison operator, e.g. `x < y`.
+ *
+ * @param mask
+ * @param a
+ * @param b
+ * @return Vector<double, 2>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> ifelse(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& mask,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& b
+) {
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>(_mm_blendv_pd(b.v, a.v, mask.v));
+}
+
+/**
+ * @brief Selects, per element, `a` where `mask` is set and `b` elsewhere.
+ * `mask` is the result of a comparison operator, e.g. `x < y`.
+ *
+ * @param mask
+ * @param a
+ * @param b
+ * @return Vector<float, 4>
+ */
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> ifelse(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& mask,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& b
+) {
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>(_mm_blendv_ps(b.v, a.v, mask.v));
+}
 
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator<, _mm_cmplt_pd)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator<, _mm_cmplt_ps)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U, operator<, _mm_cmplt_epi8)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U, operator<, _mm_cmplt_epi16)
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U, operator<, _mm_cmplt_epi32)
-#if STONEYDSP_USING_INT64_2
-// DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U, operator<, _mm_cmplt_epi64)
-#endif
+#if STONEYDSP_USING_AVX
 
 //==============================================================================
 
-// !=
+// a @ b - double_4, float_8
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<double, 2>
+ * @return Vector<double, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)2U, operator!=, _mm_cmpneq_pd)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator+, _mm256_add_pd)
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<float, 4>
+ * @return Vector<double, 4>
  */
-DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)4U, operator!=, _mm_cmpneq_ps)
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator-, _mm256_sub_pd)
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int8_t, 16>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator!=(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& b)
-{
-	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(_mm_cmpeq_epi8(a.v, b.v)) ^ Vector<::StoneyDSP::int8_t, 16U>::mask();
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator*, _mm256_mul_pd)
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int16_t, 8>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator!=(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& b)
-{
-	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(_mm_cmpeq_epi16(a.v, b.v)) ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator/, _mm256_div_pd)
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int32_t, 4>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator!=(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& b)
-{
-	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(_mm_cmpeq_epi32(a.v, b.v)) ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
-}
-
-#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator^, _mm256_xor_pd)
 
 /**
  * @brief
  *
  * @param a
  * @param b
- * @return Vector<int64_t, 2>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator!=(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& b)
-{
-	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(_mm_cmpeq_epi64(a.v, b.v)) ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
-}
-
-#endif
-
-//==============================================================================
-
-// +a
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator&, _mm256_and_pd)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator+(
-    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator|, _mm256_or_pd)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator+(
-    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator+, _mm256_add_ps)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator+(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator-, _mm256_sub_ps)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator+(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator*, _mm256_mul_ps)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator+(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator/, _mm256_div_ps)
 
-#if STONEYDSP_USING_INT64_2
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator^, _mm256_xor_ps)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator+(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return a;
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator&, _mm256_and_ps)
 
-#endif
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>
+ */
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator|, _mm256_or_ps)
 
 //==============================================================================
 
-// -a
+// a @= b - double_4, float_8
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator-(
-    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return (::StoneyDSP::double_t)0.0 - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator+=, operator+)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator-(
-    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return (::StoneyDSP::float_t)0.0f - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator-=, operator-)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator-(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
-{
-	return (::StoneyDSP::int8_t)0 - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator*=, operator*)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator-(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
-{
-	return (::StoneyDSP::int16_t)0 - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator/=, operator/)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator-(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return (::StoneyDSP::int32_t)0 - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator^=, operator^)
 
-#if STONEYDSP_USING_INT64_2
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 4>&
+ */
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator&=, operator&)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>
+ * @param b
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator-(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return _mm_castpd_si128(_mm_setzero_pd()) - a;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, operator|=, operator|)
 
-#endif
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>&
+ */
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator+=, operator+)
 
-//==============================================================================
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>&
+ */
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator-=, operator-)
 
-// ++a
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>&
+ */
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator*=, operator*)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>&
+ * @param b
+ * @return Vector<float, 8>&
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& operator++(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return a += (::StoneyDSP::double_t)1.0;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator/=, operator/)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>&
+ * @param b
+ * @return Vector<float, 8>&
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& operator++(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return a += (::StoneyDSP::float_t)1.0f;
-}
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator^=, operator^)
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>&
+ * @param b
+ * @return Vector<float, 8>&
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& operator++(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator&=, operator&)
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<float, 8>&
+ */
+DECLARE_VECTOR_OPERATOR_INCREMENT(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, operator|=, operator|)
+
+//==============================================================================
+
+// a <=> b - double_4, float_8
+
+// AVX has no dedicated comparison intrinsics; `_mm256_cmp_*` takes the
+// predicate instead. The ordered predicates match `_mm_cmp*_p*`, and `!=` is
+// unordered, as with `_mm_cmpneq_p*`.
+
+/**
+ * @brief
+ *
+ * @param a
+ * @param b
+ * @return Vector<double, 4>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator>=(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b)
 {
-	return a += (::StoneyDSP::int8_t)1;
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>&
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& operator++(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator>(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b)
 {
-	return a += (::StoneyDSP::int16_t)1;
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>&
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& operator++(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator<=(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b)
 {
-	return a += (::StoneyDSP::int32_t)1;
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ));
 }
 
-#if STONEYDSP_USING_INT64_2
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>&
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& operator++(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator<(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b)
 {
-	return a += _mm_castpd_si128(_mm_set1_pd(1.0));
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ));
 }
 
-#endif
-
-//==============================================================================
-
-// --a
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>&
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& operator--(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator!=(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b)
 {
-	return a -= (::StoneyDSP::double_t)1.0;
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_cmp_pd(a.v, b.v, _CMP_NEQ_UQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>&
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& operator--(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator>=(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b)
 {
-	return a -= (::StoneyDSP::float_t)1.0f;
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>&
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& operator--(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator>(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b)
 {
-	return a -= (::StoneyDSP::int8_t)1;
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>&
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& operator--(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator<=(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b)
 {
-	return a -= (::StoneyDSP::int16_t)1;
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ));
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>&
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& operator--(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator<(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b)
 {
-	return a -= (::StoneyDSP::int32_t)1;
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ));
 }
 
-#if STONEYDSP_USING_INT64_2
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>&
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& operator--(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator!=(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b)
 {
-	return a -= _mm_castpd_si128(_mm_set1_pd(1.0));
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ));
 }
 
-#endif
-
 //==============================================================================
 
-// a++
+// +a, -a, ~a - double_4, float_8
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator++(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator+(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a)
 {
-	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> b = a;
-	++a;
-	return b;
+	return a;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator++(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator-(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a)
 {
-	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> b = a;
-	++a;
-	return b;
+	return (::StoneyDSP::double_t)0.0 - a;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator++(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator~(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a)
 {
-	Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> b = a;
-	++a;
-	return b;
+	return a ^ Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>::mask();
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator++(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a, int)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator+(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a)
 {
-	Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> b = a;
-	++a;
-	return b;
+	return a;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator++(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a, int)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator-(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a)
 {
-	Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> b = a;
-	++a;
-	return b;
+	return (::StoneyDSP::float_t)0.0f - a;
 }
 
-#if STONEYDSP_USING_INT64_2
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator++(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, int)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator~(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a)
 {
-	Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> b = a;
-	++a;
-	return b;
+	return a ^ Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>::mask();
 }
 
-#endif
-
 //==============================================================================
 
-// a--
+// ++a, --a, a++, a-- - double_4, float_8
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator--(
-    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& operator++(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a)
 {
-	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> b = a;
-	--a;
-	return b;
+	return a += (::StoneyDSP::double_t)1.0;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>
+ * @return Vector<double, 4>&
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator--(
-    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& operator--(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a)
 {
-	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> b = a;
-	--a;
-	return b;
+	return a -= (::StoneyDSP::double_t)1.0;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<int8_t, 16>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator--(
-    Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator++(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a, int)
 {
-	Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> b = a;
-	--a;
+	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> b = a;
+	++a;
 	return b;
 }
 
@@ -2770,12 +4363,12 @@ inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator--(
  * @brief
  *
  * @param a
- * @return Vector<int16_t, 8>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator--(
-    Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a, int)
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> operator--(
+    Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a, int)
 {
-	Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> b = a;
+	Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> b = a;
 	--a;
 	return b;
 }
@@ -2784,259 +4377,237 @@ inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator--(
  * @brief
  *
  * @param a
- * @return Vector<int32_t, 4>
+ * @return Vector<float, 8>&
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator--(
-    Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a, int)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& operator++(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a)
 {
-	Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> b = a;
-	--a;
-	return b;
+	return a += (::StoneyDSP::float_t)1.0f;
 }
 
-#if STONEYDSP_USING_INT64_2
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<int64_t, 2>
+ * @return Vector<float, 8>&
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator--(
-    Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a, int)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& operator--(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a)
 {
-	Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> b = a;
-	--a;
-	return b;
+	return a -= (::StoneyDSP::float_t)1.0f;
 }
 
-#endif
-
-//==============================================================================
-
-// ~a
-
 /**
  * @brief
  *
  * @param a
- * @return Vector<double, 2>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U> operator~(
-    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator++(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a, int)
 {
-	return a ^ Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)2U>::mask();
+	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> b = a;
+	++a;
+	return b;
 }
 
 /**
  * @brief
  *
  * @param a
- * @return Vector<float, 4>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U> operator~(
-    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>& a)
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> operator--(
+    Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a, int)
 {
-	return a ^ Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)4U>::mask();
+	Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> b = a;
+	--a;
+	return b;
 }
 
+//==============================================================================
+
+// fmin(a, b), fmax(a, b) - double_4, float_8
+
 /**
- * @brief
+ * @brief Returns the element-wise minimum of `a` and `b`.
  *
  * @param a
- * @return Vector<int8_t, 16>
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator~(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a)
-{
-	return a ^ Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>::mask();
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, fmin, _mm256_min_pd)
 
 /**
- * @brief
+ * @brief Returns the element-wise maximum of `a` and `b`.
  *
  * @param a
- * @return Vector<int16_t, 8>
+ * @param b
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator~(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a)
-{
-	return a ^ Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>::mask();
-}
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::double_t, (::StoneyDSP::size_t)4U, fmax, _mm256_max_pd)
 
 /**
- * @brief
+ * @brief Returns the element-wise minimum of `a` and `b`.
  *
  * @param a
- * @return Vector<int32_t, 4>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator~(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a)
-{
-	return a ^ Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>::mask();
-}
-
-#if STONEYDSP_USING_INT64_2
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, fmin, _mm256_min_ps)
 
 /**
- * @brief
+ * @brief Returns the element-wise maximum of `a` and `b`.
  *
  * @param a
- * @return Vector<int64_t, 2>
+ * @param b
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator~(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a)
-{
-	return a ^ Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>::mask();
-}
-
-#endif
+DECLARE_VECTOR_OPERATOR_INFIX(::StoneyDSP::float_t, (::StoneyDSP::size_t)8U, fmax, _mm256_max_ps)
 
 //==============================================================================
 
-// a << b
+// clamp(x, a, b), floor(x), fabs(x), ifelse(mask, a, b) - double_4, float_8
 
 /**
- * @brief
+ * @brief Limits each element of `x` to the range `[a, b]`.
  *
+ * @param x
  * @param a
  * @param b
- * @return Vector<int8_t, 16>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator<<(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
-    const int& b
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> clamp(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& x,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b
 ) {
-	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(
-        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(x, a), b);
 }
 
 /**
- * @brief
+ * @brief Rounds each element of `x` towards negative infinity.
  *
- * @param a
- * @param b
- * @return Vector<int16_t, 8>
+ * @param x
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator<<(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
-    const int& b
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> floor(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& x
 ) {
-	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(
-        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_floor_pd(x.v));
 }
 
 /**
+ * @brief Returns the absolute value of each element of `x`.
  *
- * @brief
+ * @param x
+ * @return Vector<double, 4>
+ */
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> fabs(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& x
+) {
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x.v));
+}
+
+/**
+ * @brief Selects, per element, `a` where `mask` is set and `b` elsewhere.
+ * `mask` is the result of a comparison operator, e.g. `x < y`.
  *
+ * @param mask
  * @param a
  * @param b
- * @return Vector<int32_t, 4>
+ * @return Vector<double, 4>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator<<(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
-    const int& b
+inline Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U> ifelse(
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& mask,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& a,
+    const Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>& b
 ) {
-	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(
-        _mm_sll_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return Vector<::StoneyDSP::double_t, (::StoneyDSP::size_t)4U>(_mm256_blendv_pd(b.v, a.v, mask.v));
 }
 
-#if STONEYDSP_USING_INT64_2
-
 /**
- * @brief
+ * @brief Limits each element of `x` to the range `[a, b]`.
  *
+ * @param x
  * @param a
  * @param b
- * @return Vector<int64_t, 2>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator<<(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
-    const int& b
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> clamp(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& x,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b
 ) {
-	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(
-        _mm_sll_epi64(a.v, _mm_cvtsi64_si128(b))
-    );
+	return ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(x, a), b);
 }
 
-#endif
-
-//==============================================================================
-
-// a >> b
-
 /**
- * @brief
+ * @brief Rounds each element of `x` towards negative infinity.
  *
- * @param a
- * @param b
- * @return Vector<int8_t, 16>
+ * @param x
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U> operator>>(
-    const Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>& a,
-    const int& b
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> floor(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& x
 ) {
-	return Vector<::StoneyDSP::int8_t, (::StoneyDSP::size_t)16U>(
-        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_floor_ps(x.v));
 }
 
 /**
- * @brief
+ * @brief Returns the absolute value of each element of `x`.
  *
- * @param a
- * @param b
- * @return Vector<int16_t, 8>
+ * @param x
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U> operator>>(
-    const Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>& a,
-    const int& b
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> fabs(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& x
 ) {
-	return Vector<::StoneyDSP::int16_t, (::StoneyDSP::size_t)8U>(
-        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_andnot_ps(_mm256_set1_ps(-0.0F), x.v));
 }
 
 /**
- * @brief
+ * @brief Selects, per element, `a` where `mask` is set and `b` elsewhere.
+ * `mask` is the result of a comparison operator, e.g. `x < y`.
  *
+ * @param mask
  * @param a
  * @param b
- * @return Vector<int32_t, 4>
+ * @return Vector<float, 8>
  */
-inline Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U> operator>>(
-    const Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>& a,
-    const int& b
+inline Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U> ifelse(
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& mask,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& a,
+    const Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>& b
 ) {
-	return Vector<::StoneyDSP::int32_t, (::StoneyDSP::size_t)4U>(
-        _mm_srl_epi32(a.v, _mm_cvtsi32_si128(b))
-    );
+	return Vector<::StoneyDSP::float_t, (::StoneyDSP::size_t)8U>(_mm256_blendv_ps(b.v, a.v, mask.v));
 }
 
-#if STONEYDSP_USING_INT64_2
+#endif
+
+//==============================================================================
+
+// Scalar overloads, so that generic code can be written once for both
+// scalars and `Vector`s.
+
+using ::std::fmin;
+using ::std::fmax;
+using ::std::floor;
+using ::std::fabs;
 
 /**
- * @brief
+ * @brief Returns `a` if `mask` is true, otherwise `b`.
  *
+ * @param mask
  * @param a
  * @param b
- * @return Vector<int64_t, 2>
+ * @return T
  */
-inline Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U> operator>>(
-    const Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>& a,
-    const int& b
-) {
-	return Vector<::StoneyDSP::int64_t, (::StoneyDSP::size_t)2U>(
-        _mm_srl_epi64(a.v, _mm_cvtsi64_si128(b))
-    );
+template <typename T>
+inline T ifelse(bool mask, const T& a, const T& b) {
+	return mask ? a : b;
 }
 
-#endif
-
 //==============================================================================
 
   /// @} group SIMD
@@ -124,9 +124,15 @@ target_include_directories(SIMD
 )
 set(STONEYDSP_SIMD_HEADERS)
 set(STONEYDSP_SIMD_VECTOR_HPP "include/StoneyDSP/SIMD/Vector.hpp")
+set(STONEYDSP_SIMD_SINE_HPP "include/StoneyDSP/SIMD/Sine.hpp")
+set(STONEYDSP_SIMD_MATH_HPP "include/StoneyDSP/SIMD/Math.hpp")
+set(STONEYDSP_SIMD_POLYBUFFER_HPP "include/StoneyDSP/SIMD/PolyBuffer.hpp")
 set(STONEYDSP_SIMD_HPP "include/StoneyDSP/SIMD.hpp")
 list(APPEND STONEYDSP_SIMD_HEADERS
     "${STONEYDSP_SIMD_VECTOR_HPP}"
+    "${STONEYDSP_SIMD_SINE_HPP}"
+    "${STONEYDSP_SIMD_MATH_HPP}"
+    "${STONEYDSP_SIMD_POLYBUFFER_HPP}"
     "${STONEYDSP_SIMD_HPP}"
 )
 foreach(__header IN LISTS STONEYDSP_SIMD_HEADERS)
@@ -320,6 +326,7 @@ if(STONEYDSP_IS_TOP_LEVEL AND STONEYDSP_BUILD_TESTS)
     add_executable(StoneyDSP::Tests_StoneyDSP ALIAS Tests_StoneyDSP)
     target_sources(Tests_StoneyDSP
         PRIVATE
+            "${STONEYDSP_DIR}/test/StoneyDSP/DSP.cpp"
             "${STONEYDSP_DIR}/test/StoneyDSP/SIMD.cpp"
             "${STONEYDSP_DIR}/test/StoneyDSP/Core.cpp"
     )
@@ -327,7 +334,7 @@ if(STONEYDSP_IS_TOP_LEVEL AND STONEYDSP_BUILD_TESTS)
         PRIVATE
             StoneyDSP::Core
             StoneyDSP::SIMD
-            # StoneyDSP::DSP
+            StoneyDSP::DSP
             Catch2::Catch2WithMain
     )
     set_target_properties(Tests_StoneyDSP
@@ -0,0 +1,242 @@
+/***************************************************************************//**
+ * @file DSP.cpp
+ * @author Nathan J. Hood (nathanjhood@googlemail.com)
+ * @brief Catch2 unit tests for `StoneyDSP::DSP`
+ * @version 0.0.0
+ * @date 2024-11-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * therights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/orsell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#if __has_include(<catch2/catch_test_macros.hpp>)
+ #include <catch2/catch_test_macros.hpp>
+ #define STONEYDSP_HAS_CATCH2 1
+#elif __has_include("catch_amalgamated.hpp")
+ // portable copy
+ #include "catch_amalgamated.hpp"
+ #include "../dep/Catch2/src/catch_amalgamated.cpp"
+ #define STONEYDSP_HAS_CATCH2 1
+#else
+ #warning "Can't find Catch2 headers for unit tests!"
+#endif
+
+#include "StoneyDSP/DSP.hpp"
+
+#ifndef STONEYDSP_DSP_HPP_INCLUDED
+ #error "Couldn't find 'StoneyDSP/DSP.hpp'?"
+#endif
+
+#if STONEYDSP_HAS_CATCH2
+
+// Tests go here...
+
+TEST_CASE( "Gain", "[gain]" ) {
+
+    SECTION( "processSample" ) {
+
+        ::StoneyDSP::DSP::Gain<float> gain(0.5F);
+        REQUIRE(gain.processSample(3.0F) == 1.5F);
+
+        gain.setGain(2.0F);
+        REQUIRE(gain.getGain() == 2.0F);
+        REQUIRE(gain.processSample(3.0F) == 6.0F);
+
+        // The gain was applied at once, so the next block ramps from it
+        gain.setGain(4.0F);
+        REQUIRE(gain.getGain() == 4.0F);
+        REQUIRE(gain.getLastGain() == 2.0F);
+    }
+
+    SECTION( "processSample then a block" ) {
+
+        ::StoneyDSP::DSP::Gain<float> gain(0.0F);
+        float buffer[2] = {1.0F, 1.0F};
+
+        gain.setGain(1.0F);
+        REQUIRE(gain.processSample(1.0F) == 1.0F);
+
+        // Nothing left to ramp, so there is no step back to the initial gain
+        gain.process(buffer, 2U);
+        REQUIRE(buffer[0] == 1.0F);
+        REQUIRE(buffer[1] == 1.0F);
+    }
+
+    SECTION( "setGain twice before one block" ) {
+
+        ::StoneyDSP::DSP::Gain<double> gain(1.0);
+        double buffer[2] = {1.0, 1.0};
+
+        // Only the last target counts; the ramp starts from the gain that the
+        // previous block ended on, not from the first target
+        gain.setGain(3.0);
+        gain.setGain(2.0);
+        REQUIRE(gain.getLastGain() == 1.0);
+
+        gain.process(buffer, 2U);
+        REQUIRE(buffer[0] == 1.5);
+        REQUIRE(buffer[1] == 2.0);
+        REQUIRE(gain.getLastGain() == 2.0);
+
+        // Again, from the end of that block
+        buffer[0] = buffer[1] = 1.0;
+        gain.setGain(0.0);
+        gain.setGain(4.0);
+        gain.process(buffer, 2U);
+        REQUIRE(buffer[0] == 3.0);
+        REQUIRE(buffer[1] == 4.0);
+    }
+
+    SECTION( "ramped block, in place" ) {
+
+        ::StoneyDSP::DSP::Gain<double> gain;
+        double buffer[4] = {1.0, 1.0, 1.0, 1.0};
+
+        gain.setGain(1.0);
+        gain.process(buffer, 4U);
+
+        REQUIRE(buffer[0] == 0.25);
+        REQUIRE(buffer[1] == 0.5);
+        REQUIRE(buffer[2] == 0.75);
+        REQUIRE(buffer[3] == 1.0);
+        REQUIRE(gain.getLastGain() == 1.0);
+
+        // The ramp has completed, so the next block is flat
+        gain.process(buffer, 4U);
+        REQUIRE(buffer[0] == 0.25);
+        REQUIRE(buffer[3] == 1.0);
+    }
+
+    SECTION( "ramped block, to a target" ) {
+
+        ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::float_4> gain(1.0F);
+        const ::StoneyDSP::SIMD::float_4 input[2] = {
+            ::StoneyDSP::SIMD::float_4(2.0F),
+            ::StoneyDSP::SIMD::float_4(2.0F)
+        };
+        ::StoneyDSP::SIMD::float_4 output[2];
+
+        gain.process(input, output, 2U, ::StoneyDSP::SIMD::float_4 {0.0F, 1.0F, 2.0F, 3.0F});
+
+        REQUIRE(output[0][0] == 1.0F);
+        REQUIRE(output[0][1] == 2.0F);
+        REQUIRE(output[0][2] == 3.0F);
+        REQUIRE(output[0][3] == 4.0F);
+        REQUIRE(output[1][0] == 0.0F);
+        REQUIRE(output[1][3] == 6.0F);
+    }
+
+    SECTION( "reset" ) {
+
+        ::StoneyDSP::DSP::Gain<::StoneyDSP::SIMD::double_2> gain;
+        ::StoneyDSP::SIMD::double_2 buffer[1] = {::StoneyDSP::SIMD::double_2(1.0)};
+
+        gain.reset(::StoneyDSP::SIMD::double_2 {0.5, 0.25});
+        gain.process(buffer, 1U);
+
+        REQUIRE(buffer[0][0] == 0.5);
+        REQUIRE(buffer[0][1] == 0.25);
+    }
+}
+
+TEST_CASE( "PhaseDriver", "[phasedriver]" ) {
+
+    SECTION( "block advance matches per-sample advance" ) {
+
+        ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::float_4> block;
+        ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::float_4> serial;
+        block.freq = ::StoneyDSP::SIMD::float_4 {1.0F, 3.0F, -2.0F, 250.0F};
+        serial.freq = block.freq;
+
+        ::StoneyDSP::SIMD::float_4 phases[8];
+        block.process(::StoneyDSP::SIMD::float_4(0.01F), phases, 8U);
+
+        for (::StoneyDSP::size_t i = 0U; i < 8U; ++i) {
+            const ::StoneyDSP::SIMD::float_4 expected = serial.process(::StoneyDSP::SIMD::float_4(0.01F));
+            for (::StoneyDSP::size_t lane = 0U; lane < 4U; ++lane) {
+                REQUIRE(phases[i][lane] == expected[lane]);
+                REQUIRE(phases[i][lane] >= 0.0F);
+                REQUIRE(phases[i][lane] < 1.0F);
+            }
+        }
+        REQUIRE(block.phase[3] == serial.phase[3]);
+    }
+
+    SECTION( "masked reset" ) {
+
+        ::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::double_2> driver;
+        driver.freq = ::StoneyDSP::SIMD::double_2(1.0);
+        driver.process(::StoneyDSP::SIMD::double_2(0.25));
+
+        driver.reset(::StoneyDSP::SIMD::double_2 {0.0, 1.0} > ::StoneyDSP::SIMD::double_2(0.5));
+        REQUIRE(driver.phase[0] == 0.25);
+        REQUIRE(driver.phase[1] == 0.0);
+    }
+
+    SECTION( "hard sync on a rising edge" ) {
+
+        ::StoneyDSP::DSP::PhaseDriver<float> driver;
+        driver.freq = 1.0F;
+
+        // Starts high, so an input which is already high doesn't sync
+        driver.process(0.25F);
+        REQUIRE(driver.sync(5.0F) == 0.0F);
+        REQUIRE(driver.phase == 0.25F);
+
+        // Falls, then rises
+        REQUIRE(driver.sync(0.0F) == 0.0F);
+        REQUIRE(driver.sync(1.0F) == 0.0F);
+        REQUIRE(driver.sync(5.0F) == 1.0F);
+        REQUIRE(driver.phase == 0.0F);
+
+        // Stays high, so doesn't sync again
+        driver.process(0.25F);
+        REQUIRE(driver.sync(5.0F) == 0.0F);
+        REQUIRE(driver.phase == 0.25F);
+    }
+}
+
+TEST_CASE( "Oscillator", "[oscillator]" ) {
+
+    SECTION( "external phase matches internal phase" ) {
+
+        // A phase accumulated in double, then narrowed, shapes the same
+        // waveforms as the oscillator's own float phase
+        ::StoneyDSP::DSP::Oscillator<float> internal, external;
+        ::StoneyDSP::DSP::PhaseDriver<double> precise;
+        internal.freq = external.freq = 4.0F;
+        precise.freq = 4.0;
+
+        for (int i = 0; i < 32; i++) {
+            internal.process(1.0F / 64.0F);
+            external.setPhase(static_cast<float>(precise.process(1.0 / 64.0)), 1.0F / 64.0F);
+            REQUIRE(external.phase == internal.phase);
+            REQUIRE(external.saw() == internal.saw());
+            REQUIRE(external.pulse(0.5F) == internal.pulse(0.5F));
+        }
+    }
+}
+
+#endif // STONEYDSP_HAS_CATCH2
@@ -33,6 +33,7 @@
 
 #if __has_include(<catch2/catch_test_macros.hpp>)
  #include <catch2/catch_test_macros.hpp>
+ #include <catch2/matchers/catch_matchers_floating_point.hpp>
  #define STONEYDSP_HAS_CATCH2 1
 #elif __has_include("catch_amalgamated.hpp")
  // portable copy
@@ -257,6 +258,338 @@ TEST_CASE( "Vector<float_t, 4>", "[float_4]" ) {
         REQUIRE(vector_of_four_floats.size == 4U);
         REQUIRE(sizeof(vector_of_four_floats.v) == 16U);
     }
+
+    SECTION( "fmin, fmax and clamp" ) {
+
+        ::StoneyDSP::SIMD::float_4 a {-2.0F, -0.5F, 0.5F, 2.0F};
+        ::StoneyDSP::SIMD::float_4 b {0.0F};
+
+        ::StoneyDSP::SIMD::float_4 lo = ::StoneyDSP::SIMD::fmin(a, b);
+        ::StoneyDSP::SIMD::float_4 hi = ::StoneyDSP::SIMD::fmax(a, b);
+        ::StoneyDSP::SIMD::float_4 clamped = ::StoneyDSP::SIMD::clamp(a, -1.0F, 1.0F);
+
+        REQUIRE(lo[0] == -2.0F);
+        REQUIRE(lo[3] == 0.0F);
+        REQUIRE(hi[0] == 0.0F);
+        REQUIRE(hi[3] == 2.0F);
+        REQUIRE(clamped[0] == -1.0F);
+        REQUIRE(clamped[1] == -0.5F);
+        REQUIRE(clamped[2] == 0.5F);
+        REQUIRE(clamped[3] == 1.0F);
+    }
+
+    SECTION( "fabs and ifelse" ) {
+
+        ::StoneyDSP::SIMD::float_4 a {-2.0F, -0.5F, 0.5F, 2.0F};
+
+        ::StoneyDSP::SIMD::float_4 absolute = ::StoneyDSP::SIMD::fabs(a);
+        ::StoneyDSP::SIMD::float_4 selected = ::StoneyDSP::SIMD::ifelse(a < 0.0F, 1.0F, -1.0F);
+
+        REQUIRE(absolute[0] == 2.0F);
+        REQUIRE(absolute[1] == 0.5F);
+        REQUIRE(absolute[3] == 2.0F);
+        REQUIRE(selected[0] == 1.0F);
+        REQUIRE(selected[1] == 1.0F);
+        REQUIRE(selected[2] == -1.0F);
+        REQUIRE(selected[3] == -1.0F);
+    }
+
+    SECTION( "conversions to and from double_2" ) {
+
+        ::StoneyDSP::SIMD::float_4 a {1.0F, 2.0F, 3.0F, 4.0F};
+
+        ::StoneyDSP::SIMD::double_2 lo(a);
+        ::StoneyDSP::SIMD::double_2 hi = ::StoneyDSP::SIMD::double_2::convertHigh(a);
+        ::StoneyDSP::SIMD::float_4 b(lo, hi);
+
+        REQUIRE(lo[0] == 1.0);
+        REQUIRE(lo[1] == 2.0);
+        REQUIRE(hi[0] == 3.0);
+        REQUIRE(hi[1] == 4.0);
+        for (::StoneyDSP::size_t i = 0U; i < 4U; ++i) {
+            REQUIRE(b[i] == a[i]);
+        }
+    }
+}
+
+#if STONEYDSP_USING_AVX
+
+TEST_CASE( "Vector<double_t, 4>", "[double_4]" ) {
+
+    SECTION( "size tests" ) {
+
+        // sizeof class
+        REQUIRE(sizeof(StoneyDSP::SIMD::double_4) == 32U);
+
+        ::StoneyDSP::SIMD::double_4 vector_of_four_doubles {
+            (::StoneyDSP::double_t)0.0
+        };
+
+        // sizeof class members
+        REQUIRE(vector_of_four_doubles.size == 4U);
+        REQUIRE(sizeof(vector_of_four_doubles.v) == 32U);
+    }
+
+    SECTION( "conversions" ) {
+
+        ::StoneyDSP::SIMD::float_4 a {-2.0F, -0.5F, 0.5F, 2.0F};
+
+        ::StoneyDSP::SIMD::double_4 widened {a};
+        ::StoneyDSP::SIMD::float_4 narrowed {widened * 2.0};
+
+        REQUIRE(widened[0] == -2.0);
+        REQUIRE(widened[3] == 2.0);
+        REQUIRE(narrowed[1] == -1.0F);
+        REQUIRE(narrowed[2] == 1.0F);
+    }
+}
+
+TEST_CASE( "Vector<float_t, 8>", "[float_8]" ) {
+
+    SECTION( "size tests" ) {
+
+        // sizeof class
+        REQUIRE(sizeof(StoneyDSP::SIMD::float_8) == 32U);
+
+        ::StoneyDSP::SIMD::float_8 vector_of_eight_floats {
+            (::StoneyDSP::float_t)0.0F
+        };
+
+        // sizeof class members
+        REQUIRE(vector_of_eight_floats.size == 8U);
+        REQUIRE(sizeof(vector_of_eight_floats.v) == 32U);
+    }
+
+    SECTION( "load, store and halves" ) {
+
+        ::StoneyDSP::float_t in[8] = {0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F};
+        ::StoneyDSP::float_t out[8] = {};
+
+        ::StoneyDSP::SIMD::float_8 a = ::StoneyDSP::SIMD::float_8::load(in);
+        ::StoneyDSP::SIMD::float_8 b {
+            ::StoneyDSP::SIMD::float_4::load(&in[0]),
+            ::StoneyDSP::SIMD::float_4::load(&in[4])
+        };
+
+        (a + b).store(out);
+
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(out[i] == 2.0F * in[i]);
+        }
+    }
+
+    SECTION( "clamp, fabs and ifelse" ) {
+
+        ::StoneyDSP::SIMD::float_8 a {-2.0F, -0.5F, 0.5F, 2.0F, -4.0F, -1.0F, 1.0F, 4.0F};
+
+        ::StoneyDSP::SIMD::float_8 clamped = ::StoneyDSP::SIMD::clamp(a, -1.0F, 1.0F);
+        ::StoneyDSP::SIMD::float_8 absolute = ::StoneyDSP::SIMD::fabs(a);
+        ::StoneyDSP::SIMD::float_8 selected = ::StoneyDSP::SIMD::ifelse(a < 0.0F, 1.0F, -1.0F);
+
+        REQUIRE(clamped[0] == -1.0F);
+        REQUIRE(clamped[1] == -0.5F);
+        REQUIRE(clamped[7] == 1.0F);
+        REQUIRE(absolute[4] == 4.0F);
+        REQUIRE(absolute[7] == 4.0F);
+        REQUIRE(selected[5] == 1.0F);
+        REQUIRE(selected[6] == -1.0F);
+    }
+}
+
+#endif
+
+TEST_CASE( "sin2pi", "[sine]" ) {
+
+    SECTION( "error bounds per accuracy tier" ) {
+
+        double maxErrorLow = 0.0, maxErrorMedium = 0.0, maxErrorHigh = 0.0;
+
+        for (int i = -1000; i <= 1000; ++i) {
+            const double phase = static_cast<double>(i) / 500.0;
+            const double expected = std::sin(2.0 * M_PI * phase);
+            maxErrorLow = std::fmax(maxErrorLow, std::fabs(::StoneyDSP::SIMD::sin2pi<::StoneyDSP::SIMD::SineAccuracy::Low>(phase) - expected));
+            maxErrorMedium = std::fmax(maxErrorMedium, std::fabs(::StoneyDSP::SIMD::sin2pi<::StoneyDSP::SIMD::SineAccuracy::Medium>(phase) - expected));
+            maxErrorHigh = std::fmax(maxErrorHigh, std::fabs(::StoneyDSP::SIMD::sin2pi<::StoneyDSP::SIMD::SineAccuracy::High>(phase) - expected));
+        }
+
+        REQUIRE(maxErrorLow < 7e-5);
+        REQUIRE(maxErrorMedium < 6e-7);
+        REQUIRE(maxErrorHigh < 4e-9);
+    }
+
+    // The vector and scalar overloads evaluate the same approximations, but
+    // the compiler may contract them differently (e.g. into FMAs), so each
+    // side is only within the documented error of the true value, and they
+    // may differ by up to twice that
+    using ::Catch::Matchers::WithinAbs;
+    using ::Catch::Matchers::WithinRel;
+
+    SECTION( "vectors match scalars" ) {
+
+        ::StoneyDSP::SIMD::float_4 phase {0.1F, 0.35F, 0.6F, 0.85F};
+        ::StoneyDSP::SIMD::double_2 radians {1.0, -2.0};
+
+        ::StoneyDSP::SIMD::float_4 y = ::StoneyDSP::SIMD::sin2pi(phase);
+        ::StoneyDSP::SIMD::double_2 z = ::StoneyDSP::SIMD::sin(radians);
+
+        for (::StoneyDSP::size_t i = 0U; i < 4U; ++i) {
+            REQUIRE_THAT(y[i], WithinAbs(::StoneyDSP::SIMD::sin2pi(phase[i]), 2.0F * 5.9e-7F));
+        }
+        REQUIRE_THAT(z[0], WithinAbs(::StoneyDSP::SIMD::sin(1.0), 2.0 * 5.9e-7));
+        REQUIRE_THAT(z[1], WithinAbs(::StoneyDSP::SIMD::sin(-2.0), 2.0 * 5.9e-7));
+    }
+}
+
+TEST_CASE( "exp2, log2, pow, tanh", "[math]" ) {
+
+    SECTION( "float error bounds" ) {
+
+        double maxErrorExp2 = 0.0, maxErrorLog2 = 0.0, maxErrorPow = 0.0, maxErrorTanh = 0.0;
+
+        for (int i = -1000; i <= 1000; ++i) {
+            const float x = static_cast<float>(i) / 125.0F;  // [-8, 8]
+            const float m = std::exp2(static_cast<float>(i) / 1000.0F);  // [0.5, 2]
+            const double expected = std::exp2(static_cast<double>(x));
+            maxErrorExp2 = std::fmax(maxErrorExp2, std::fabs((::StoneyDSP::SIMD::exp2(x) - expected) / expected));
+            maxErrorLog2 = std::fmax(maxErrorLog2, std::fabs(::StoneyDSP::SIMD::log2(m) - std::log2(static_cast<double>(m))));
+            maxErrorPow = std::fmax(maxErrorPow, std::fabs((::StoneyDSP::SIMD::pow(m, x) - std::pow(static_cast<double>(m), static_cast<double>(x))) / std::pow(static_cast<double>(m), static_cast<double>(x))));
+            maxErrorTanh = std::fmax(maxErrorTanh, std::fabs(::StoneyDSP::SIMD::tanh(x) - std::tanh(static_cast<double>(x))));
+        }
+
+        REQUIRE(maxErrorExp2 < 2.5e-7);
+        REQUIRE(maxErrorLog2 < 1.2e-7);
+        REQUIRE(maxErrorPow < 7.1e-7);
+        REQUIRE(maxErrorTanh < 1.6e-7);
+    }
+
+    SECTION( "double error bounds" ) {
+
+        double maxErrorExp2 = 0.0, maxErrorLog2 = 0.0, maxErrorTanh = 0.0;
+
+        for (int i = -1000; i <= 1000; ++i) {
+            const double x = static_cast<double>(i) / 125.0;
+            const double m = std::exp2(static_cast<double>(i) / 1000.0);
+            maxErrorExp2 = std::fmax(maxErrorExp2, std::fabs((::StoneyDSP::SIMD::exp2(x) - std::exp2(x)) / std::exp2(x)));
+            maxErrorLog2 = std::fmax(maxErrorLog2, std::fabs(::StoneyDSP::SIMD::log2(m) - std::log2(m)));
+            maxErrorTanh = std::fmax(maxErrorTanh, std::fabs(::StoneyDSP::SIMD::tanh(x) - std::tanh(x)));
+        }
+
+        REQUIRE(maxErrorExp2 < 4.8e-16);
+        REQUIRE(maxErrorLog2 < 3.4e-16);
+        REQUIRE(maxErrorTanh < 3.4e-16);
+    }
+
+    SECTION( "limits" ) {
+
+        REQUIRE(::StoneyDSP::SIMD::exp2(0.0F) == 1.0F);
+        REQUIRE(::StoneyDSP::SIMD::exp2(10.0) == 1024.0);
+        REQUIRE(::StoneyDSP::SIMD::exp2(-1000.0F) == std::exp2(-126.0F));
+        REQUIRE(::StoneyDSP::SIMD::exp2(1000.0F) == std::exp2(127.0F));
+        REQUIRE(::StoneyDSP::SIMD::log2(1.0F) == 0.0F);
+        REQUIRE(::StoneyDSP::SIMD::log2(0.125) == -3.0);
+        REQUIRE(::StoneyDSP::SIMD::tanh(100.0F) == 1.0F);
+        REQUIRE(::StoneyDSP::SIMD::tanh(-100.0) == -1.0);
+        REQUIRE(std::fabs(::StoneyDSP::SIMD::cos2pi(0.5) + 1.0) < 6e-7);
+        REQUIRE(std::fabs(::StoneyDSP::SIMD::cos(0.0F) - 1.0F) < 6e-7);
+    }
+
+    // As above, each side is within the documented error of the true value
+    using ::Catch::Matchers::WithinAbs;
+    using ::Catch::Matchers::WithinRel;
+
+    SECTION( "vectors match scalars" ) {
+
+        ::StoneyDSP::SIMD::float_4 x {-3.7F, -0.2F, 0.45F, 5.3F};
+        ::StoneyDSP::SIMD::float_4 m {0.01F, 0.9F, 1.6F, 300.0F};
+        ::StoneyDSP::SIMD::double_2 y {-3.7, 5.3};
+        ::StoneyDSP::SIMD::double_2 n {0.01, 300.0};
+
+        ::StoneyDSP::SIMD::float_4 e = ::StoneyDSP::SIMD::exp2(x);
+        ::StoneyDSP::SIMD::float_4 l = ::StoneyDSP::SIMD::log2(m);
+        ::StoneyDSP::SIMD::float_4 p = ::StoneyDSP::SIMD::pow(m, x);
+        ::StoneyDSP::SIMD::float_4 t = ::StoneyDSP::SIMD::tanh(x);
+        ::StoneyDSP::SIMD::float_4 c = ::StoneyDSP::SIMD::cos(x);
+
+        for (::StoneyDSP::size_t i = 0U; i < 4U; ++i) {
+            REQUIRE_THAT(e[i], WithinRel(::StoneyDSP::SIMD::exp2(x[i]), 2.0F * 2.5e-7F));
+            REQUIRE_THAT(l[i], WithinAbs(::StoneyDSP::SIMD::log2(m[i]), 2.0F * 1.2e-7F) || WithinRel(::StoneyDSP::SIMD::log2(m[i]), 2.0F * 1.0e-7F));
+            REQUIRE_THAT(p[i], WithinRel(::StoneyDSP::SIMD::pow(m[i], x[i]), 2.0F * 7.1e-7F));
+            REQUIRE_THAT(t[i], WithinAbs(::StoneyDSP::SIMD::tanh(x[i]), 2.0F * 1.6e-7F));
+            REQUIRE_THAT(c[i], WithinAbs(::StoneyDSP::SIMD::cos(x[i]), 2.0F * 5.9e-7F));
+        }
+
+        ::StoneyDSP::SIMD::double_2 f = ::StoneyDSP::SIMD::exp2(y);
+        ::StoneyDSP::SIMD::double_2 g = ::StoneyDSP::SIMD::log2(n);
+        ::StoneyDSP::SIMD::double_2 h = ::StoneyDSP::SIMD::pow(n, y);
+
+        for (::StoneyDSP::size_t i = 0U; i < 2U; ++i) {
+            REQUIRE_THAT(f[i], WithinRel(::StoneyDSP::SIMD::exp2(y[i]), 2.0 * 4.8e-16));
+            REQUIRE_THAT(g[i], WithinAbs(::StoneyDSP::SIMD::log2(n[i]), 2.0 * 3.4e-16) || WithinRel(::StoneyDSP::SIMD::log2(n[i]), 2.0 * 2.3e-16));
+            REQUIRE_THAT(h[i], WithinRel(::StoneyDSP::SIMD::pow(n[i], y[i]), 2.0 * 1.8e-15));
+        }
+    }
+
+#if STONEYDSP_USING_AVX
+    SECTION( "wide vectors match scalars" ) {
+
+        ::StoneyDSP::SIMD::float_8 x {-3.7F, -0.2F, 0.45F, 5.3F, -9.1F, 0.0F, 1.0F, 12.5F};
+        ::StoneyDSP::SIMD::float_8 m {0.01F, 0.9F, 1.6F, 300.0F, 1.0F, 0.5F, 2.0F, 1.0e6F};
+        ::StoneyDSP::SIMD::double_4 y {-3.7, 5.3, 0.0, 12.5};
+        ::StoneyDSP::SIMD::double_4 n {0.01, 300.0, 1.0, 1.0e6};
+
+        ::StoneyDSP::SIMD::float_8 e = ::StoneyDSP::SIMD::exp2(x);
+        ::StoneyDSP::SIMD::float_8 l = ::StoneyDSP::SIMD::log2(m);
+
+        for (::StoneyDSP::size_t i = 0U; i < 8U; ++i) {
+            REQUIRE_THAT(e[i], WithinRel(::StoneyDSP::SIMD::exp2(x[i]), 2.0F * 2.5e-7F));
+            REQUIRE_THAT(l[i], WithinAbs(::StoneyDSP::SIMD::log2(m[i]), 2.0F * 1.2e-7F) || WithinRel(::StoneyDSP::SIMD::log2(m[i]), 2.0F * 1.0e-7F));
+        }
+
+        ::StoneyDSP::SIMD::double_4 f = ::StoneyDSP::SIMD::exp2(y);
+        ::StoneyDSP::SIMD::double_4 g = ::StoneyDSP::SIMD::log2(n);
+
+        for (::StoneyDSP::size_t i = 0U; i < 4U; ++i) {
+            REQUIRE_THAT(f[i], WithinRel(::StoneyDSP::SIMD::exp2(y[i]), 2.0 * 4.8e-16));
+            REQUIRE_THAT(g[i], WithinAbs(::StoneyDSP::SIMD::log2(n[i]), 2.0 * 3.4e-16) || WithinRel(::StoneyDSP::SIMD::log2(n[i]), 2.0 * 2.3e-16));
+        }
+    }
+#endif
+}
+
+TEST_CASE( "PolyBuffer", "[polybuffer]" ) {
+
+    SECTION( "alignment and padding" ) {
+
+        REQUIRE(alignof(::StoneyDSP::SIMD::PolyBuffer<float>) == STONEYDSP_POLYBUFFER_ALIGNMENT);
+        REQUIRE(sizeof(::StoneyDSP::SIMD::PolyBuffer<float>) % STONEYDSP_POLYBUFFER_ALIGNMENT == 0U);
+        REQUIRE(sizeof(::StoneyDSP::SIMD::PolyBuffer<float, 20U>) % STONEYDSP_POLYBUFFER_ALIGNMENT == 0U);
+        REQUIRE(::StoneyDSP::SIMD::PolyBuffer<float>::size() == 16U);
+
+        ::StoneyDSP::SIMD::PolyBuffer<double> buffer;
+        REQUIRE(reinterpret_cast<::std::uintptr_t>(buffer.data()) % STONEYDSP_POLYBUFFER_ALIGNMENT == 0U);
+        for (const auto &x : buffer) {
+            REQUIRE(x == 0.0);
+        }
+    }
+
+    SECTION( "vector loads and stores" ) {
+
+        ::StoneyDSP::SIMD::PolyBuffer<float> buffer(1.0F);
+        buffer.store(4U, ::StoneyDSP::SIMD::float_4 {2.0F, 3.0F, 4.0F, 5.0F});
+
+        REQUIRE(buffer[3] == 1.0F);
+        REQUIRE(buffer[4] == 2.0F);
+        REQUIRE(buffer[7] == 5.0F);
+        REQUIRE(buffer[8] == 1.0F);
+
+        ::StoneyDSP::SIMD::float_4 v = buffer.load<::StoneyDSP::SIMD::float_4>(4U);
+        REQUIRE(v[1] == 3.0F);
+
+        ::StoneyDSP::SIMD::PolyBuffer<double> doubles;
+        doubles.store(14U, ::StoneyDSP::SIMD::double_2 {6.0, 7.0});
+        REQUIRE(doubles.load<::StoneyDSP::SIMD::double_2>(14U)[1] == 7.0);
+        REQUIRE(::StoneyDSP::SIMD::double_2::loadAligned(doubles.data() + 14U)[0] == 6.0);
+    }
 }
 
 TEST_CASE( "Vector<int8_t, 16>", "[int_8]" ) {
@@ -36,6 +36,7 @@
 
 #include <rack.hpp>
 #include <StoneyDSP/Core.hpp>
+#include <StoneyDSP/SIMD.hpp>
 
 //==============================================================================
 
@@ -52,6 +53,40 @@
  #define assert_message(condition, message) ::StoneyDSP::ignoreUnused(condition, message)
 #endif
 
+/**
+ * `STONEYVCV_ALWAYS_INLINE` forces the modules' per-sample helpers inline
+ * where the compiler supports it, so that they cost no call in `process()`.
+ */
+#if STONEYDSP_GCC || STONEYDSP_CLANG
+ #define STONEYVCV_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+ #define STONEYVCV_ALWAYS_INLINE inline
+#endif
+
+/**
+ * `STONEYVCV_INSTRUMENTATION` is set by the build option of the same name,
+ * to count the cycles, channels and paths taken by each call to a module's
+ * `process()`. Otherwise the instrumentation is compiled out entirely,
+ * including the statements wrapped in `STONEYVCV_INSTRUMENT()`.
+ */
+#ifndef STONEYVCV_INSTRUMENTATION
+ #define STONEYVCV_INSTRUMENTATION 0
+#endif
+
+#if STONEYVCV_INSTRUMENTATION
+ #define STONEYVCV_INSTRUMENT(statement) statement
+ #include <atomic>
+ #if STONEYDSP_INTEL && STONEYDSP_MSVC
+  #include <intrin.h>
+ #elif STONEYDSP_INTEL
+  #include <x86intrin.h>
+ #else
+  #include <chrono>
+ #endif
+#else
+ #define STONEYVCV_INSTRUMENT(statement)
+#endif
+
 // #if defined (STONEYDSP_DEBUG)
 //  #include <iostream>
 //  #define DBG(x, ...) do { x } while (false)
@@ -111,6 +146,26 @@ const extern ::StoneyDSP::float_t vBias;
 const extern ::StoneyDSP::float_t vGround;
 const extern ::StoneyDSP::float_t vFloor;
 
+/**
+ * @brief The number of control-rate divisions offered by the modules.
+ *
+ */
+static constexpr ::StoneyDSP::size_t numControlRateDivisions = 5U;
+
+/**
+ * @brief The control-rate divisions, in samples, offered by the modules'
+ * context menus. Knob-derived coefficients are recomputed once per division
+ * and smoothed in between.
+ *
+ */
+const extern ::StoneyDSP::uint32_t controlRateDivisions[::StoneyDSP::StoneyVCV::Tools::numControlRateDivisions];
+
+/**
+ * @brief The default control-rate division, in samples.
+ *
+ */
+const extern ::StoneyDSP::uint32_t controlRateDivision;
+
 //==============================================================================
 
   /// @} group Tools
@@ -118,9 +173,19 @@ const extern ::StoneyDSP::float_t vFloor;
 
 //==============================================================================
 
-// Declare an abstract base class with a pure virtual destructor.
-// It's the simplest possible abstract class.
-template <typename T>
+/**
+ * @brief The `Engine` struct. A statically-dispatched base for the DSP
+ * engines owned by each module.
+ *
+ * `TEngine` derives from `Engine<T, TEngine>` and implements a (non-virtual)
+ * `void processSample(T* sample)`. Calls through the base are resolved at
+ * compile time, so there is no vtable and `processSample` can be inlined into
+ * the owning module's channel loop.
+ *
+ * @tparam T The sample type, i.e. `float`, `double`, `float_4`, `double_2`.
+ * @tparam TEngine The derived engine type.
+ */
+template <typename T, class TEngine>
 struct Engine
 {
 
@@ -135,11 +200,74 @@ public:
         DBG("Constructing StoneyDSP::StoneyVCV::Engine");
     };
 
-    virtual ~Engine() noexcept = 0;                                             // pure virtual
+    //==========================================================================
+
+    /**
+     * @brief Processes a single sample in-place, dispatching to
+     * `TEngine::processSample`.
+     *
+     * @param sample
+     */
+    void processSample(T* sample)
+    {
+        this->getEngine().processSample(sample);
+    }
+
+    /**
+     * @brief Processes `numSamples` contiguous samples from `input` into
+     * `output`, dispatching to `TEngine::processSample` for each. `input`
+     * and `output` may be the same buffer.
+     *
+     * Engines that can do better than one call per sample provide their own
+     * `processSamples`.
+     *
+     * @param input
+     * @param output
+     * @param numSamples
+     */
+    void processSamples(const T* input, T* output, ::std::size_t numSamples)
+    {
+        auto &engine = this->getEngine();
+        for (::std::size_t i = 0U; i < numSamples; ++i) {
+            output[i] = input[i];
+            engine.processSample(&output[i]);
+        }
+    }
+
+    /**
+     * @brief Processes `numSamples` contiguous samples in-place.
+     *
+     * @param buffer
+     * @param numSamples
+     */
+    void processSamples(T* buffer, ::std::size_t numSamples)
+    {
+        this->processSamples(buffer, buffer, numSamples);
+    }
+
+    //==========================================================================
+
+protected:
 
     //==========================================================================
 
-    virtual void processSample(T* sample) = 0;                                  // pure virtual
+    /**
+     * @brief Not virtual; engines are never destroyed through the base.
+     *
+     */
+    ~Engine() noexcept;
+
+    //==========================================================================
+
+    TEngine& getEngine() noexcept
+    {
+        return static_cast<TEngine&>(*this);
+    }
+
+    const TEngine& getEngine() const noexcept
+    {
+        return static_cast<const TEngine&>(*this);
+    }
 
     //==========================================================================
 
@@ -147,20 +275,379 @@ private:
 
     //==========================================================================
 
+    /**
+     * @brief `true` if the given `processSample(T*)` was declared by a class
+     * other than this one, i.e. `TEngine` did not just inherit ours.
+     *
+     */
+    template <class C>
+    static constexpr bool isImplementedBy(void (C::*)(T*)) noexcept
+    {
+        return !::std::is_same<C, ::StoneyDSP::StoneyVCV::Engine<T, TEngine>>::value;
+    }
+
+    //==========================================================================
+
     STONEYDSP_DECLARE_NON_COPYABLE(Engine)
     STONEYDSP_DECLARE_NON_MOVEABLE(Engine)
     // STONEYDSP_PREVENT_HEAP_ALLOCATION
 };
 
-template <class T>
-::StoneyDSP::StoneyVCV::Engine<T>::~Engine() noexcept
+template <typename T, class TEngine>
+::StoneyDSP::StoneyVCV::Engine<T, TEngine>::~Engine() noexcept
 {
+    static_assert(::std::is_base_of<::StoneyDSP::StoneyVCV::Engine<T, TEngine>, TEngine>::value, "TEngine must be derived from StoneyDSP::StoneyVCV::Engine<T, TEngine>");
+    static_assert(::StoneyDSP::StoneyVCV::Engine<T, TEngine>::isImplementedBy(&TEngine::processSample), "TEngine must implement processSample(T*)");
+
     DBG("Destroying StoneyDSP::StoneyVCV::Engine");
 }
 
-// Explicit instantiations to ensure the definition is visible to the linker...
-template struct ::StoneyDSP::StoneyVCV::Engine<double>;
-template struct ::StoneyDSP::StoneyVCV::Engine<float>;
+//==============================================================================
+
+/**
+ * @brief The `Coefficients` struct. The per-sample constants that a module
+ * derives from the sample rate and from its own settings; rebuilt by
+ * `update()` from the module's `onSampleRateChange()` and settings setters,
+ * rather than recomputed in every call to `process()`.
+ *
+ */
+struct Coefficients
+{
+    /**
+     * @brief The sample rate, in Hz.
+     *
+     */
+    float sampleRate = 44100.0F;
+
+    /**
+     * @brief The sample time, in seconds.
+     *
+     */
+    float sampleTime = 1.0F / 44100.0F;
+
+    /**
+     * @brief The sample time, in seconds, for double precision accumulators.
+     *
+     */
+    double preciseSampleTime = 1.0 / 44100.0;
+
+    /**
+     * @brief The time, in seconds, between two updates of the lights; for
+     * `Light::setBrightnessSmooth()`.
+     *
+     */
+    float lightDeltaTime = 16.0F / 44100.0F;
+
+    /**
+     * @brief The reciprocal of the control-rate division, by which the
+     * control-rate ramps' increments are scaled.
+     *
+     */
+    float controlRateReciprocal = 1.0F / 16.0F;
+
+    /**
+     * @brief Rebuilds every coefficient.
+     *
+     * @param newSampleRate The sample rate, in Hz.
+     * @param lightDivision The number of samples between light updates.
+     * @param controlRateDivision The number of samples between control-rate
+     * updates.
+     */
+    void update(float newSampleRate, ::StoneyDSP::uint32_t lightDivision, ::StoneyDSP::uint32_t controlRateDivision) noexcept;
+};
+
+//==============================================================================
+
+/**
+ * @brief The `PeakMeter` struct. Tracks the running peak of a polyphonic
+ * signal over a block of samples, one vector of channels at a time and over
+ * the active channels only, for the lights to read once per block.
+ *
+ * The peak is held in a vector and only reduced to a scalar by `flush()`, so
+ * metering costs one `fmax` per vector per sample. The decay between blocks
+ * is left to `Light::setBrightnessSmooth()`, which rises at once and falls
+ * exponentially.
+ *
+ * @tparam V The vector type, e.g. `float_4`.
+ */
+template <class V>
+struct PeakMeter
+{
+    /**
+     * @brief Folds the `V::size` channels starting at `channel` into the
+     * running peak; those at or beyond `numChannels` are ignored.
+     *
+     * @param v Non-negative levels.
+     * @param channel Less than `numChannels`.
+     * @param numChannels
+     */
+    void process(const V &v, ::std::size_t channel, ::std::size_t numChannels) noexcept
+    {
+        assert(channel < numChannels);
+
+        V active = v;
+        // Only the last vector of a block of channels can be partly active;
+        // bounded, so that a vector wholly beyond `numChannels` is ignored
+        // rather than wrapping around to count every lane
+        const ::std::size_t numActive = (channel < numChannels) ? ::std::min<::std::size_t>(numChannels - channel, V::size) : 0U;
+        for (::std::size_t lane = numActive; lane < V::size; ++lane)
+            active[lane] = 0.0F;
+        this->peak = ::StoneyDSP::SIMD::fmax(this->peak, active);
+    }
+
+    /**
+     * @brief Returns the peak since the last call, and starts a new block.
+     *
+     */
+    float flush() noexcept
+    {
+        float value = 0.0F;
+        for (::std::size_t lane = 0U; lane < V::size; ++lane)
+            value = ::std::max(value, this->peak[lane]);
+        this->peak = V(0.0F);
+        return value;
+    }
+
+    /**
+     * @brief The running peak of each lane.
+     *
+     */
+    V peak = V(0.0F);
+};
+
+//==============================================================================
+
+/**
+ * @brief The `VoiceMeter` struct. Drives a row of per-voice lights from a
+ * bank's per-channel levels, once per light block.
+ *
+ * Applies the same rise-at-once, fall-exponentially smoothing as
+ * `Light::setBrightnessSmooth()`, but one vector of voices at a time and
+ * without branching; the lights are then written in a single pass.
+ * Inactive voices fade out.
+ *
+ * @tparam V The vector type, e.g. `float_4`.
+ */
+template <class V>
+struct VoiceMeter
+{
+    /**
+     * @brief Smooths each voice towards `levels * scale + offset`, clamped
+     * to `[0, 1]`, and writes the result to `lights`.
+     *
+     * @param levels The bank's per-channel levels.
+     * @param numChannels
+     * @param deltaTime The time since the last call, in seconds.
+     * @param lights The first of `PolyBuffer<float>::size()` lights.
+     * @param scale
+     * @param offset
+     */
+    void process(
+        const ::StoneyDSP::SIMD::PolyBuffer<float> &levels,
+        ::std::size_t numChannels,
+        float deltaTime,
+        ::rack::engine::Light *lights,
+        float scale = 1.0F,
+        float offset = 0.0F
+    ) noexcept
+    {
+        // The fall rate of `Light::setBrightnessSmooth()`
+        const V release = V(30.0F * deltaTime);
+
+        for (::std::size_t channel = 0U; channel < this->brightness.size(); channel += V::size) {
+            V target = V(0.0F);
+            if (channel < numChannels) {
+                target = ::StoneyDSP::SIMD::clamp(levels.load<V>(channel) * V(scale) + V(offset), V(0.0F), V(1.0F));
+                for (::std::size_t lane = numChannels - channel; lane < V::size; ++lane)
+                    target[lane] = 0.0F;
+            }
+            const V value = this->brightness.load<V>(channel);
+            this->brightness.store(channel, ::StoneyDSP::SIMD::ifelse(target < value, value + ((target - value) * release), target));
+        }
+
+        for (::std::size_t voice = 0U; voice < this->brightness.size(); ++voice)
+            lights[voice].setBrightness(this->brightness[voice]);
+    }
+
+    /**
+     * @brief Turns every voice's light off at once.
+     *
+     * @param lights The first of `PolyBuffer<float>::size()` lights.
+     */
+    void reset(::rack::engine::Light *lights) noexcept
+    {
+        this->brightness.fill(0.0F);
+        for (::std::size_t voice = 0U; voice < this->brightness.size(); ++voice)
+            lights[voice].setBrightness(0.0F);
+    }
+
+    /**
+     * @brief The brightness of each voice's light.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> brightness;
+};
+
+//==============================================================================
+
+#if STONEYVCV_INSTRUMENTATION
+
+/**
+ * @brief The `Instrumentation` struct. Counts the cost of each call to a
+ * module's `process()` by the number of channels that it processed, and how
+ * often each of the module's named paths through it was taken.
+ *
+ * The counters are only written by the engine thread, and read by the UI
+ * thread through `snapshot()`; each is a relaxed `std::atomic`, which costs
+ * the engine thread a plain load and store, so a reader sees at worst one
+ * call that is half-counted. `reset()` is deferred to the engine thread's
+ * next call to `begin()`.
+ *
+ * Cycles are read from the time-stamp counter on x86, and are nanoseconds
+ * from `std::chrono::steady_clock` elsewhere.
+ */
+struct Instrumentation
+{
+    /**
+     * @brief The most paths that a module can name.
+     *
+     */
+    static constexpr ::std::size_t maxPaths = 8U;
+
+    /**
+     * @brief The most channels that a call can process.
+     *
+     */
+    static constexpr ::std::size_t maxChannels = static_cast<::std::size_t>(::rack::engine::PORT_MAX_CHANNELS);
+
+    /**
+     * @brief Constructs a new `Instrumentation` object.
+     *
+     * @param newPathNames The name of each path, e.g. for the menu and JSON.
+     * @param newNumPaths At most `maxPaths`.
+     */
+    Instrumentation(const char *const *newPathNames, ::std::size_t newNumPaths) noexcept;
+
+    /**
+     * @brief Reads the cycle counter.
+     *
+     */
+    static STONEYVCV_ALWAYS_INLINE ::StoneyDSP::uint64_t now() noexcept
+    {
+#if STONEYDSP_INTEL
+        return static_cast<::StoneyDSP::uint64_t>(__rdtsc());
+#else
+        return static_cast<::StoneyDSP::uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Starts counting a call.
+     *
+     */
+    STONEYVCV_ALWAYS_INLINE void begin() noexcept
+    {
+        if (this->resetRequested.load(::std::memory_order_relaxed)) {
+            this->clear();
+            this->resetRequested.store(false, ::std::memory_order_relaxed);
+        }
+        this->start = ::StoneyDSP::StoneyVCV::Instrumentation::now();
+    }
+
+    /**
+     * @brief Counts a call, begun by `begin()`, that processed `numChannels`
+     * channels; `0` when idle.
+     *
+     * @param numChannels
+     */
+    STONEYVCV_ALWAYS_INLINE void end(::std::size_t numChannels) noexcept
+    {
+        const ::StoneyDSP::uint64_t elapsed = ::StoneyDSP::StoneyVCV::Instrumentation::now() - this->start;
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->calls, 1U);
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->cycles, elapsed);
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->voices, numChannels);
+        if (elapsed < this->minCycles.load(::std::memory_order_relaxed))
+            this->minCycles.store(elapsed, ::std::memory_order_relaxed);
+        if (elapsed > this->maxCycles.load(::std::memory_order_relaxed))
+            this->maxCycles.store(elapsed, ::std::memory_order_relaxed);
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->channelCalls[numChannels], 1U);
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->channelCycles[numChannels], elapsed);
+    }
+
+    /**
+     * @brief Counts a call's taking the path at `index`.
+     *
+     * @param index
+     */
+    STONEYVCV_ALWAYS_INLINE void path(::std::size_t index) noexcept
+    {
+        ::StoneyDSP::StoneyVCV::Instrumentation::add(this->pathCalls[index], 1U);
+    }
+
+    /**
+     * @brief Clears every counter, from any thread.
+     *
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief A copy of the counters, as read by `snapshot()`.
+     *
+     */
+    struct Snapshot
+    {
+        ::StoneyDSP::uint64_t calls;
+        ::StoneyDSP::uint64_t cycles;
+        ::StoneyDSP::uint64_t voices;
+        ::StoneyDSP::uint64_t minCycles;
+        ::StoneyDSP::uint64_t maxCycles;
+        ::StoneyDSP::uint64_t channelCalls[maxChannels + 1U];
+        ::StoneyDSP::uint64_t channelCycles[maxChannels + 1U];
+        ::StoneyDSP::uint64_t pathCalls[maxPaths];
+    };
+
+    /**
+     * @brief Reads the counters, from any thread.
+     *
+     */
+    Snapshot snapshot() const noexcept;
+
+    /**
+     * @brief Returns the counters, with the mean cycles per call and per
+     * voice, for `dataToJson()`.
+     *
+     */
+    ::json_t *toJson() const;
+
+    const char *const *pathNames;
+    ::std::size_t numPaths;
+
+private:
+    /**
+     * @brief Adds `value` to `counter`; there is only one writer, so a
+     * relaxed load and store will do, rather than a locked add.
+     *
+     */
+    static STONEYVCV_ALWAYS_INLINE void add(::std::atomic<::StoneyDSP::uint64_t> &counter, ::StoneyDSP::uint64_t value) noexcept
+    {
+        counter.store(counter.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+    }
+
+    void clear() noexcept;
+
+    ::StoneyDSP::uint64_t start;
+    ::std::atomic<::StoneyDSP::uint64_t> calls;
+    ::std::atomic<::StoneyDSP::uint64_t> cycles;
+    ::std::atomic<::StoneyDSP::uint64_t> voices;
+    ::std::atomic<::StoneyDSP::uint64_t> minCycles;
+    ::std::atomic<::StoneyDSP::uint64_t> maxCycles;
+    ::std::atomic<::StoneyDSP::uint64_t> channelCalls[maxChannels + 1U];
+    ::std::atomic<::StoneyDSP::uint64_t> channelCycles[maxChannels + 1U];
+    ::std::atomic<::StoneyDSP::uint64_t> pathCalls[maxPaths];
+    ::std::atomic<bool> resetRequested;
+};
+
+#endif
 
 //==============================================================================
 
@@ -404,6 +891,35 @@ inline TPortWidget *createOutputCentered(::rack::math::Vec pos, ::rack::engine::
 // Explicit instantiations to ensure the definition is visible to the linker...
 template ::rack::app::PortWidget *::StoneyDSP::StoneyVCV::createOutputCentered<::rack::app::PortWidget>(::rack::math::Vec pos, ::rack::engine::Module *module, int inputId);
 
+//==============================================================================
+
+/**
+ * @brief Creates a context menu item to select a module's control-rate
+ * division from `Tools::controlRateDivisions`.
+ *
+ * @param getter Returns the current division, in samples.
+ * @param setter Sets a new division, in samples.
+ * @return ::rack::ui::MenuItem*
+ */
+::rack::ui::MenuItem *createControlRateMenuItem(
+    ::std::function<::StoneyDSP::uint32_t()> getter,
+    ::std::function<void(::StoneyDSP::uint32_t)> setter
+);
+
+#if STONEYVCV_INSTRUMENTATION
+/**
+ * @brief Creates a context menu item with a submenu of a module's
+ * instrumentation, as it is when the submenu is opened, and an item to
+ * reset it.
+ *
+ * @param instrumentation
+ * @return ::rack::ui::MenuItem*
+ */
+::rack::ui::MenuItem *createInstrumentationMenuItem(
+    ::StoneyDSP::StoneyVCV::Instrumentation *instrumentation
+);
+#endif
+
 //==============================================================================
 
   /// @} group StoneyVCV
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * @file include/StoneyVCV/Kernels.hpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief @PROJECT_DESCRIPTION@
+ * @version @STONEYVCV_VERSION@
+ *
+ * @copyright MIT License
+ *
+ * Copyright (c) 2024 Nathan J. Hood <nathanjhood@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#define STONEYVCV_KERNELS_HPP_INCLUDED 1
+
+//==============================================================================
+
+#include <StoneyDSP/Core.hpp>
+
+//==============================================================================
+
+#include <cstddef>
+
+//==============================================================================
+
+/**
+ * `STONEYVCV_DISPATCH` is set where the engines' wide kernels are compiled
+ * once per instruction set into the same binary, and the best one for the
+ * host CPU is selected at runtime; i.e. on x86 with GCC or Clang. Elsewhere
+ * (e.g. arm64, where NEON is the baseline) only the baseline is built.
+ */
+#if STONEYDSP_INTEL && (STONEYDSP_GCC || STONEYDSP_CLANG)
+ #define STONEYVCV_DISPATCH 1
+#else
+ #define STONEYVCV_DISPATCH 0
+#endif
+
+//==============================================================================
+
+namespace StoneyDSP
+{
+/** @addtogroup StoneyDSP
+ *  @{
+ */
+
+//==============================================================================
+
+namespace StoneyVCV
+{
+/** @addtogroup StoneyVCV
+ *  @{
+ */
+
+//==============================================================================
+
+/**
+ * @brief The `Kernels` namespace. The engines' inner loops, compiled once
+ * per instruction set, and the table through which the best of them for the
+ * host CPU is selected at `init()`.
+ *
+ * Each instruction set's kernels live in a translation unit of their own,
+ * compiled for it through a target pragma; they and their helpers have
+ * internal linkage, so that no code compiled for a wider instruction set can
+ * stand in for the baseline's at link time.
+ *
+ * Every buffer passed to a kernel holds 16 channels, as a polyphonic cable
+ * does.
+ *
+ */
+namespace Kernels
+{
+/** @addtogroup Kernels
+ *  @{
+ */
+
+//==============================================================================
+
+/**
+ * @brief The instruction sets that the kernels are compiled for. `Baseline`
+ * is whatever the plugin itself is built for, i.e. SSE4.2 under Rack's
+ * `-march=nehalem`, or NEON on arm64.
+ *
+ */
+enum class InstructionSet : ::StoneyDSP::uint32_t {
+    Baseline = 0U,
+    AVX = 1U,
+    AVX2 = 2U
+};
+
+/**
+ * @brief Advances the gain of all 16 channels by `step`, then applies it to
+ * the first `numChannels` channels of `input`, writing them to `output`;
+ * `input` and `output` may be the same buffer.
+ *
+ */
+using VCAGainKernel = void (*)(const float *input, float *output, float *gain, const float *step, ::std::size_t numChannels);
+
+/**
+ * @brief Shapes the sine, triangle, band-limited saw and band-limited pulse
+ * of the first `numChannels` channels, each in `[-1, 1]`, from their
+ * `phase` in `[0, 1)`, `frequency` in Hz and `pulseWidth` in `(0, 1)`, as
+ * `LFO::LFOEngine::processSample()` does.
+ *
+ */
+using LFOWaveformsKernel = void (*)(const float *phase, const float *frequency, const float *pulseWidth, float sampleTime, float *sin, float *tri, float *saw, float *sqr, ::std::size_t numChannels);
+
+/**
+ * @brief The `Table` struct. One instruction set's kernels. An entry is
+ * `nullptr` where the engine's own `float_4` code is used instead, as it is
+ * throughout the baseline table.
+ *
+ */
+struct Table
+{
+    ::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet;
+    ::StoneyDSP::StoneyVCV::Kernels::VCAGainKernel vcaGain;
+    ::StoneyDSP::StoneyVCV::Kernels::LFOWaveformsKernel lfoWaveforms;
+};
+
+//==============================================================================
+
+/**
+ * @brief Detects the best instruction set supported by the host CPU, and
+ * makes its table the one returned by `get()`. Called once, from the
+ * plugin's `init()`; engines created afterwards use its kernels.
+ *
+ * @return The selected table.
+ */
+const ::StoneyDSP::StoneyVCV::Kernels::Table &select() noexcept;
+
+/**
+ * @brief The table selected by `select()`, or the baseline table if it has
+ * not been called.
+ *
+ */
+const ::StoneyDSP::StoneyVCV::Kernels::Table &get() noexcept;
+
+/**
+ * @brief The table for `instructionSet`, whether or not the host CPU
+ * supports it; or the baseline table where it is not built.
+ *
+ * @param instructionSet
+ */
+const ::StoneyDSP::StoneyVCV::Kernels::Table &get(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept;
+
+/**
+ * @brief Whether `instructionSet`'s kernels are built, and the host CPU
+ * supports them.
+ *
+ * @param instructionSet
+ */
+bool isSupported(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept;
+
+/**
+ * @brief A human-readable name for `instructionSet`, e.g. for logging.
+ *
+ * @param instructionSet
+ */
+const char *getName(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept;
+
+#if STONEYVCV_DISPATCH
+/**
+ * @brief The AVX kernels, 8 channels wide; defined in `Kernels/AVX.cpp`.
+ *
+ */
+extern const ::StoneyDSP::StoneyVCV::Kernels::Table avx;
+
+/**
+ * @brief The AVX2 and FMA kernels, 8 channels wide; defined in
+ * `Kernels/AVX2.cpp`.
+ *
+ */
+extern const ::StoneyDSP::StoneyVCV::Kernels::Table avx2;
+#endif
+
+//==============================================================================
+
+  /// @} group Kernels
+} // namespace Kernels
+
+//==============================================================================
+
+  /// @} group StoneyVCV
+} // namespace StoneyVCV
+
+//==============================================================================
+
+  /// @} group StoneyDSP
+} // namespace StoneyDSP
+
+//==============================================================================
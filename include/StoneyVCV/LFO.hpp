@@ -41,6 +41,7 @@
 #include <StoneyVCV/ComponentLibrary/PortWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/PanelWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/RoundKnobWidget.hpp>
+#include <StoneyVCV/Kernels.hpp>
 #include <StoneyVCV/plugin.hpp>
 
 //==============================================================================
@@ -53,6 +54,7 @@
 //==============================================================================
 
 #include <array>
+#include <atomic>
 
 //==============================================================================
 
@@ -92,7 +94,7 @@ namespace LFO
  *
  */
 template<typename T>
-struct LFOEngine : virtual ::StoneyDSP::StoneyVCV::Engine<T>
+struct LFOEngine : ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>>
 {
     //==========================================================================
 
@@ -104,16 +106,100 @@ public:
 
     LFOEngine(T sample);
 
-    virtual ~LFOEngine() noexcept;
+    ~LFOEngine() noexcept;
 
     //==========================================================================
 
-    void processSample(T *sample) override;
+    /**
+     * @brief Advances the phase by one sample and writes the new phase, in
+     * the range `[0, 1)`, to `sample`.
+     *
+     * @param sample
+     */
+    void processSample(T *sample);
+
+    /**
+     * @brief Advances the phase by one sample and derives all four waveforms
+     * from the new phase, each in the range `[-1, 1]`.
+     *
+     * @param sin
+     * @param tri
+     * @param saw
+     * @param sqr
+     */
+    void processSample(T *sin, T *tri, T *saw, T *sqr);
+
+    /**
+     * @brief Derives all four waveforms, each in the range `[-1, 1]`, from
+     * `phase` rather than from the engine's own phase accumulator; for
+     * callers that accumulate the phase at a higher precision than `T`.
+     *
+     * @param phase The phase, in the range `[0, 1)`.
+     * @param sin
+     * @param tri
+     * @param saw
+     * @param sqr
+     */
+    void processSample(const T &phase, T *sin, T *tri, T *saw, T *sqr);
+
+    using ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>>::processSamples;
+
+    /**
+     * @brief Writes `numSamples` contiguous samples to `output`, ramping the
+     * frequency linearly from its current value to `targetFrequency` across
+     * the block.
+     *
+     * @param output
+     * @param numSamples
+     * @param targetFrequency
+     */
+    void processSamples(T *output, ::std::size_t numSamples, const T &targetFrequency);
+
+    /**
+     * @brief Resets the phase to `0` (hard sync).
+     *
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Resets the phase to `0` (hard sync) only where `mask` is set,
+     * e.g. in the lanes of a `Vector` where a comparison held.
+     *
+     * @param mask
+     */
+    void reset(const T &mask) noexcept;
+
+    /**
+     * @brief Hard sync: resets the phase to `0` wherever `input` has a
+     * rising edge (through a Schmitt trigger, like Rack's trigger inputs).
+     *
+     * @param input
+     * @return `1` where there was a rising edge, otherwise `0`.
+     */
+    T sync(const T &input) noexcept;
 
     void setFrequency(const T &newFrequency);
 
     T& getFrequency() noexcept;
 
+    /**
+     * @brief Sets the pulse width of the square wave, as a fraction of the
+     * period in the range `[0, 1]`.
+     *
+     * @param newPulseWidth
+     */
+    void setPulseWidth(const T &newPulseWidth);
+
+    T& getPulseWidth() noexcept;
+
+    /**
+     * @brief Sets the time, in seconds, that each processed sample advances
+     * the phase by.
+     *
+     * @param newSampleTime
+     */
+    void setSampleTime(const T &newSampleTime);
+
     //==========================================================================
 
 private:
@@ -121,10 +207,19 @@ private:
     //==========================================================================
 
     /**
-     * @brief
+     * @brief Shapes all four waveforms from the oscillator's current `phase`.
+     *
+     */
+    void processWaveforms(const T &phase, T *sin, T *tri, T *saw, T *sqr);
+
+    //==========================================================================
+
+    /**
+     * @brief Holds the phase and the frequency, and band-limits the saw and
+     * square so that the engine may also run at audio rate.
      *
      */
-    T frequency = 2.0F;
+    ::StoneyDSP::DSP::Oscillator<T> oscillator;
 
     /**
      * @brief
@@ -136,7 +231,13 @@ private:
      * @brief
      *
      */
-    T phase = 0.0F;
+    T pulseWidth = 0.5F;
+
+    /**
+     * @brief
+     *
+     */
+    T sampleTime = 1.0F / 44100.0F;
 
     STONEYDSP_DECLARE_NON_COPYABLE(LFOEngine)
     STONEYDSP_DECLARE_NON_MOVEABLE(LFOEngine)
@@ -144,6 +245,160 @@ private:
 
 //==============================================================================
 
+/**
+ * @brief The `LFOEngineBank` struct. The state of every voice of a
+ * polyphonic LFO, stored structure-of-arrays style: each field is one
+ * contiguous, aligned 16-lane buffer, and all active voices are advanced by
+ * a single call to `process()`, one `float_4` of channels at a time.
+ *
+ * Each `float_4` of voices is driven by a `DSP::PhaseDriver`, or by two
+ * `double_2` ones in double precision, and shaped by one shared
+ * `LFOEngine<float_4>`; or, where `Kernels::select()` has found a wider
+ * instruction set, by its `Kernels::LFOWaveformsKernel`, 8 voices at a time,
+ * once every phase has been advanced.
+ *
+ * The caller stages each voice's `frequency`, `pulseWidth`, `resetting` and
+ * `syncInput` before calling `process()`, then reads the waveforms back from
+ * `sin`, `tri`, `saw` and `sqr`.
+ *
+ */
+struct LFOEngineBank
+{
+    //==========================================================================
+
+public:
+
+    //==========================================================================
+
+    LFOEngineBank();
+
+    ~LFOEngineBank() noexcept;
+
+    //==========================================================================
+
+    /**
+     * @brief Advances the first `numChannels` voices by one sample, and
+     * derives their waveforms. A voice's phase is first reset to `0` where
+     * `resetting` is set, or where `syncInput` has a rising edge.
+     *
+     * @param sampleTime The sample time, in seconds.
+     * @param numChannels
+     */
+    STONEYVCV_ALWAYS_INLINE void process(double sampleTime, ::std::size_t numChannels) noexcept;
+
+    /**
+     * @brief Resets every voice's phase to `0`.
+     *
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Selects whether the phase is accumulated in double precision,
+     * rather than single. The waveforms are single precision either way.
+     * When the mode changes, each voice's phase carries over from the
+     * accumulator that was driving it, so the voices don't jump.
+     *
+     * @param newDoublePrecisionPhase
+     */
+    void setDoublePrecisionPhase(bool newDoublePrecisionPhase) noexcept;
+
+    bool getDoublePrecisionPhase() const noexcept;
+
+    /**
+     * @brief Uses `kernels`' `Kernels::LFOWaveformsKernel` from the next call
+     * to `process()`, or the shared `LFOEngine` where it has none. Each bank
+     * starts with `Kernels::get()`'s.
+     *
+     * @param kernels
+     */
+    void setKernels(const ::StoneyDSP::StoneyVCV::Kernels::Table &kernels) noexcept;
+
+    //==========================================================================
+
+    /**
+     * @brief The frequency of each voice, in Hz.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> frequency;
+
+    /**
+     * @brief The pulse width of each voice, in `(0, 1)`.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> pulseWidth;
+
+    /**
+     * @brief Non-zero for each voice whose phase is to be reset by the next
+     * call to `process()`, e.g. on a clock edge.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> resetting;
+
+    /**
+     * @brief The hard sync input of each voice, in volts.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> syncInput;
+
+    /**
+     * @brief The waveforms of each voice, each in `[-1, 1]`, as of the last
+     * call to `process()`.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> sin, tri, saw, sqr;
+
+    //==========================================================================
+
+private:
+
+    //==========================================================================
+
+    /**
+     * @brief The single precision phase of each `float_4` of voices; their
+     * hard sync triggers are used in either mode.
+     *
+     */
+    ::std::array<::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::float_4>, ::StoneyDSP::SIMD::PolyBuffer<float>::size() / ::StoneyDSP::SIMD::float_4::size> phaseDrivers;
+
+    /**
+     * @brief The double precision phase of each `double_2` of voices.
+     *
+     */
+    ::std::array<::StoneyDSP::DSP::PhaseDriver<::StoneyDSP::SIMD::double_2>, ::StoneyDSP::SIMD::PolyBuffer<float>::size() / ::StoneyDSP::SIMD::double_2::size> precisePhaseDrivers;
+
+    /**
+     * @brief Shapes the waveforms of each `float_4` of voices from its phase,
+     * frequency and pulse width.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::StoneyDSP::SIMD::float_4> shaper;
+
+    /**
+     * @brief The phase of each voice, as advanced by the last call to
+     * `process()`; staged for `waveformsKernel`.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> phase;
+
+    /**
+     * @brief The selected kernel, or `nullptr` for `shaper`.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Kernels::LFOWaveformsKernel waveformsKernel = nullptr;
+
+    /**
+     * @brief Whether `precisePhaseDrivers`, rather than `phaseDrivers`, drive
+     * the voices.
+     *
+     */
+    bool doublePrecisionPhase = false;
+
+    STONEYDSP_DECLARE_NON_COPYABLE(LFOEngineBank)
+    STONEYDSP_DECLARE_NON_MOVEABLE(LFOEngineBank)
+};
+
+//==============================================================================
+
 /**
  * @brief The `LFOModule` struct.
  *
@@ -190,10 +445,26 @@ public:
 
     enum IdxLights {
         ENUMS(BLINK_LIGHT, 2),
+        ENUMS(VOICE_LIGHTS, 16),
         /** Number of Lights. */
         NUM_LIGHTS
     };
 
+#if STONEYVCV_INSTRUMENTATION
+    enum IdxPaths {
+        IDLE_PATH,
+        CONTROL_RATE_PATH,
+        FM_PATH,
+        CLOCK_PATH,
+        PWM_PATH,
+        DOUBLE_PRECISION_PATH,
+        LIGHTS_PATH,
+        VOICE_LIGHTS_PATH,
+        /** Number of Paths. */
+        NUM_PATHS
+    };
+#endif
+
     //==========================================================================
 
     /**
@@ -217,6 +488,22 @@ public:
      */
     virtual void process(const ::StoneyDSP::StoneyVCV::LFO::LFOModule::ProcessArgs& args) override;
 
+    /**
+     * @brief Called after a cable is connected to or disconnected from one of
+     * the module's ports; updates the cached `connections` mask.
+     *
+     * @param e
+     */
+    void onPortChange(const ::rack::engine::Module::PortChangeEvent& e) override;
+
+    /**
+     * @brief Called when the engine's sample rate changes, and when the
+     * module is added to the engine; rebuilds the cached `coefficients`.
+     *
+     * @param e
+     */
+    void onSampleRateChange(const ::rack::engine::Module::SampleRateChangeEvent& e) override;
+
     /**
      * @brief Store extra internal data in the "data" property of the module's JSON object.
      *
@@ -234,10 +521,83 @@ public:
 
     //==========================================================================
 
+    /**
+     * @brief Sets the number of samples between control-rate updates of the
+     * knob-derived frequency and pulse width.
+     *
+     * @param newDivision
+     */
+    void setControlRateDivision(::StoneyDSP::uint32_t newDivision) noexcept;
+
+    ::StoneyDSP::uint32_t getControlRateDivision() noexcept;
+
+    /**
+     * @brief Selects whether the phase is accumulated in double precision,
+     * so that very slow or long-running LFOs don't drift or stall as the
+     * phase increment approaches the resolution of a float. The outputs
+     * remain single precision either way.
+     *
+     * @param newDoublePrecisionPhase
+     */
+    void setDoublePrecisionPhase(bool newDoublePrecisionPhase) noexcept;
+
+    bool getDoublePrecisionPhase() noexcept;
+
+    /**
+     * @brief Shows or hides the per-voice sine lights; while hidden, they
+     * cost nothing. The lights are cleared by the next call to `process()`.
+     *
+     * @param newVoiceLights
+     */
+    void setVoiceLights(bool newVoiceLights) noexcept;
+
+    bool getVoiceLights() noexcept;
+
+#if STONEYVCV_INSTRUMENTATION
+    /**
+     * @brief The cycles, channels and `IdxPaths` counted by `process()`.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Instrumentation &getInstrumentation() noexcept;
+#endif
+
+    //==========================================================================
+
 private:
 
     //==========================================================================
 
+    /**
+     * @brief The channel loop, over the first `numChannels` channels.
+     *
+     * @param numChannels
+     */
+    void processChannels(::std::size_t numChannels);
+
+    /**
+     * @brief Times the clock of `channel` from its `voltage`, so that its
+     * frequency can follow the clock rate. The frequency is only known from
+     * the second edge after the clock is patched, since the time before the
+     * first is not a period.
+     *
+     * @param channel
+     * @param voltage
+     * @return `true` on a rising clock edge.
+     */
+    STONEYVCV_ALWAYS_INLINE bool processClock(::std::size_t channel, float voltage);
+
+    /**
+     * @brief Sets the lights from the peak sine metered since the last call,
+     * and the per-voice lights from the sines of the first `numChannels`
+     * channels; with no channels, as while idle, every light fades out.
+     * Called at the light rate.
+     *
+     * @param numChannels
+     */
+    void processLights(::std::size_t numChannels);
+
+    //==========================================================================
+
     /**
      * @brief
      *
@@ -245,16 +605,124 @@ private:
     ::rack::dsp::ClockDivider lightDivider;
 
     /**
-     * @brief
+     * @brief Divides the sample rate down to the control rate, at which the
+     * knobs are read.
      *
      */
-    ::std::array<::StoneyDSP::StoneyVCV::LFO::LFOEngine<float>, 16> engine;
+    ::rack::dsp::ClockDivider controlDivider;
 
     /**
-     * @brief
+     * @brief The per-sample constants derived from the sample rate and the
+     * dividers, read by `process()`.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Coefficients coefficients;
+
+    /**
+     * @brief The `FREQ_PARAM` knob as a frequency in Hz, ramped linearly
+     * towards the latest control-rate value over one division.
      *
      */
-    ::std::array<float, 16> lightGains;
+    float frequencyCoefficient = 2.0F;
+
+    /**
+     * @brief The per-sample increment of `frequencyCoefficient`.
+     *
+     */
+    float frequencyCoefficientStep = 0.0F;
+
+    /**
+     * @brief The `PWM_PARAM` knob as a pulse width in `[0, 1]`, ramped
+     * linearly towards the latest control-rate value over one division.
+     *
+     */
+    float pulseWidthCoefficient = 0.5F;
+
+    /**
+     * @brief The per-sample increment of `pulseWidthCoefficient`.
+     *
+     */
+    float pulseWidthCoefficientStep = 0.0F;
+
+    /**
+     * @brief The `TRIMPOT_FM_PARAM` and `TRIMPOT_PWM_PARAM` attenuverters as
+     * `-1..1`, updated at the control rate.
+     *
+     */
+    float fmAmount = 0.0F, pwmAmount = 0.0F;
+
+    /**
+     * @brief One bit per connected port; inputs by `IdxInputs`, then outputs
+     * by `NUM_INPUTS + IdxOutputs`. Maintained by `onPortChange()` so that
+     * `process()` can select its fast path without querying the ports.
+     *
+     */
+    ::StoneyDSP::uint32_t connections = 0U;
+
+    /**
+     * @brief The state of every voice.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::LFO::LFOEngineBank bank;
+
+    /**
+     * @brief Rising-edge detectors for the `CLK_INPUT`, per channel.
+     *
+     */
+    ::std::array<::rack::dsp::SchmittTrigger, 16> clockTriggers;
+
+    /**
+     * @brief Seconds elapsed since the last clock edge, per channel.
+     *
+     */
+    ::std::array<float, 16> clockTimers;
+
+    /**
+     * @brief Whether an edge has been seen since the clock was patched, per
+     * channel; only then does `clockTimers` time a whole period.
+     *
+     */
+    ::std::array<bool, 16> clockTimed;
+
+    /**
+     * @brief The frequency of the incoming clock in Hz, per channel; `0` if
+     * not yet known.
+     *
+     */
+    ::std::array<float, 16> clockFrequencies;
+
+    /**
+     * @brief The peak of the active channels' sines, for the lights.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::PeakMeter<::StoneyDSP::SIMD::float_4> meter;
+
+    /**
+     * @brief The sine of each channel, for the per-voice lights.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::VoiceMeter<::StoneyDSP::SIMD::float_4> voiceMeter;
+
+    /**
+     * @brief Whether the per-voice lights are shown.
+     *
+     */
+    ::std::atomic<bool> voiceLights;
+
+    /**
+     * @brief Set by `setVoiceLights()`, on the UI thread, so that the lights
+     * are cleared by `process()` rather than under its feet.
+     *
+     */
+    ::std::atomic<bool> voiceLightsResetRequested;
+
+#if STONEYVCV_INSTRUMENTATION
+    /**
+     * @brief The cost of each call to `process()`, and the paths it took.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Instrumentation instrumentation;
+#endif
 
     //==========================================================================
 
@@ -374,6 +842,13 @@ public:
      */
     virtual void step() override;
 
+    /**
+     * @brief Adds the module's options to its context menu.
+     *
+     * @param menu
+     */
+    virtual void appendContextMenu(::rack::ui::Menu *menu) override;
+
     //==========================================================================
 
     /**
@@ -531,6 +1006,11 @@ private:
      */
     ::rack::componentlibrary::MediumLight<::rack::componentlibrary::GreenRedLight> *lightLfo = NULL;
 
+    /**
+     * @brief 2mm LEDs showing each voice's sine, in two rows of eight.
+     */
+    ::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight> *voiceLights[16] = {};
+
     //==========================================================================
 
     /**
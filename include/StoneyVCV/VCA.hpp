@@ -41,6 +41,7 @@
 #include <StoneyVCV/ComponentLibrary/PortWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/PanelWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/RoundKnobWidget.hpp>
+#include <StoneyVCV/Kernels.hpp>
 #include <StoneyVCV/plugin.hpp>
 
 //==============================================================================
@@ -53,6 +54,7 @@
 //==============================================================================
 
 #include <array>
+#include <atomic>
 
 //==============================================================================
 
@@ -87,12 +89,30 @@ namespace VCA
 
 //==============================================================================
 
+/**
+ * @brief The response curves that map a VCA's control level to its gain.
+ *
+ * `Exponential` is linear in decibels across 60dB, as
+ * `(2^(10 * level) - 1) / 1023`; `Logarithmic` is its inverse, as
+ * `log2(1 + 1023 * level) / 10`. Both are defined for a `level` in `[0, 1]`,
+ * to which it is clamped, and map `0` to `0` and `1` to `1`. `Linear` passes
+ * the level through unchanged, so a level above `1` boosts, as it always has.
+ *
+ */
+enum class Response : ::StoneyDSP::uint32_t {
+    Linear = 0U,
+    Exponential = 1U,
+    Logarithmic = 2U
+};
+
+//==============================================================================
+
 /**
  * @brief The `VCAEngine` struct.
  *
  */
 template<typename T>
-struct VCAEngine : virtual ::StoneyDSP::StoneyVCV::Engine<T>
+struct VCAEngine : ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>>
 {
     //==========================================================================
 
@@ -102,19 +122,91 @@ public:
 
     VCAEngine();
 
-    virtual ~VCAEngine() noexcept;
+    ~VCAEngine() noexcept;
 
     //==========================================================================
 
-    void processSample(T *sample) override;
+    /**
+     * @brief Applies the gain to one sample at once, without ramping; the
+     * next block processed by `processSamples()` ramps from it. The same goes
+     * for `processSampleSimd()`.
+     *
+     * @param sample
+     */
+    void processSample(T *sample);
+
+    /**
+     * @brief Applies the gain to `numSamples` contiguous samples from
+     * `input`, writing them to `output`. `input` and `output` may be the same
+     * buffer.
+     *
+     * If the gain was changed by `setGain()` since the last block, it is
+     * ramped linearly from the gain applied at the end of the previous block
+     * (`getLastGain()`) to the new gain across the block, so that a gain sampled at block rate does not cause
+     * zipper noise. The new gain is reached on the last sample of the block.
+     *
+     * @param input
+     * @param output
+     * @param numSamples
+     */
+    void processSamples(const T *input, T *output, ::std::size_t numSamples);
+
+    /**
+     * @brief Sets the gain to `targetGain`, then applies a linear gain ramp
+     * towards it across `numSamples` contiguous samples, as above. The gain
+     * equals `targetGain` on the last sample of the block, and afterwards.
+     *
+     * @param input
+     * @param output
+     * @param numSamples
+     * @param targetGain
+     */
+    void processSamples(const T *input, T *output, ::std::size_t numSamples, const T &targetGain);
+
+    void processSamples(T *buffer, ::std::size_t numSamples);
 
     void processSampleSimd(::StoneyDSP::SIMD::float_4 *v);
 
     void processSampleSimd(::StoneyDSP::SIMD::double_2 *v);
 
+#if STONEYDSP_USING_AVX
+    void processSampleSimd(::StoneyDSP::SIMD::float_8 *v);
+
+    void processSampleSimd(::StoneyDSP::SIMD::double_4 *v);
+#endif
+
+    /**
+     * @brief Sets the gain that the next block processed by
+     * `processSamples()` ramps towards. Only the last call before a block
+     * counts; the ramp always starts from the gain applied at the end of the
+     * previous block.
+     *
+     * @param newGain
+     */
     void setGain(const T &newGain);
 
-    T& getGain() noexcept;
+    const T& getGain() const noexcept;
+
+    const T& getLastGain() const noexcept;
+
+    /**
+     * @brief Selects the curve through which `setGain()` and the
+     * `targetGain` of `processSamples()` are mapped to the applied gain.
+     *
+     * @param newResponse
+     */
+    void setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept;
+
+    ::StoneyDSP::StoneyVCV::VCA::Response getResponse() const noexcept;
+
+    /**
+     * @brief Maps a control `level` to a gain through `response`, with the
+     * vectorized `SIMD::exp2()` and `SIMD::log2()` rather than `std::pow`.
+     *
+     * @param level
+     * @param response
+     */
+    static T applyResponse(const T &level, ::StoneyDSP::StoneyVCV::VCA::Response response) noexcept;
 
     //==========================================================================
 
@@ -123,16 +215,18 @@ private:
     //==========================================================================
 
     /**
-     * @brief
+     * @brief The curve applied by `setGain()`.
      *
      */
-    T gain;
+    ::StoneyDSP::StoneyVCV::VCA::Response response = ::StoneyDSP::StoneyVCV::VCA::Response::Linear;
 
     /**
-     * @brief
+     * @brief The gain kernel. Its gain is applied by `processSample()`, and
+     * reached at the end of each block by `processSamples()`, which ramp
+     * from its last gain.
      *
      */
-    T lastGain;
+    ::StoneyDSP::DSP::Gain<T> gain;
 
     STONEYDSP_DECLARE_NON_COPYABLE(VCAEngine)
     STONEYDSP_DECLARE_NON_MOVEABLE(VCAEngine)
@@ -140,6 +234,203 @@ private:
 
 //==============================================================================
 
+/**
+ * @brief The `VCAEngineBank` struct. The gain of every voice of a polyphonic
+ * cable, held channel by channel; all active voices are processed by a single
+ * call, one vector of channels at a time.
+ *
+ * `setGain()` only stages a target gain, e.g. once per control-rate division.
+ * The gain is ramped to the staged targets linearly across `setRampLength()`
+ * calls to `process()`, reaching them on the last sample of the ramp, as
+ * `DSP::Gain` does across a block; the next ramp then starts towards whatever
+ * has been staged since. A knob or CV read at the control rate is therefore
+ * smoothed over the whole division, rather than stepped once per division.
+ *
+ * Where `Kernels::select()` has found a wider instruction set, the ramp and
+ * the gain are applied by its `Kernels::VCAGainKernel`, 8 channels at a time;
+ * otherwise by the `vector_type` code below.
+ *
+ */
+struct VCAEngineBank
+{
+    //==========================================================================
+
+public:
+
+    //==========================================================================
+
+    /**
+     * @brief The widest vector the whole plugin is built for; `float_8` when
+     * it is built for AVX (e.g. `-march=native`), or `float_4` otherwise, as
+     * under Rack's default `-march=nehalem`. Used where no kernel has been
+     * selected at runtime, and for `setGain()` and `getGain()`.
+     *
+     */
+#if STONEYDSP_USING_AVX
+    using vector_type = ::StoneyDSP::SIMD::float_8;
+#else
+    using vector_type = ::StoneyDSP::SIMD::float_4;
+#endif
+
+    //==========================================================================
+
+    VCAEngineBank();
+
+    ~VCAEngineBank() noexcept;
+
+    //==========================================================================
+
+    /**
+     * @brief Advances the ramp of every channel by one sample, then applies
+     * each channel's gain to the first `numChannels` channels of `input`,
+     * writing them to `output`. Both must hold all 16 channels; they may be
+     * the same buffer.
+     *
+     * @param input
+     * @param output
+     * @param numChannels
+     */
+    STONEYVCV_ALWAYS_INLINE void process(const float *input, float *output, ::std::size_t numChannels) noexcept;
+
+    /**
+     * @brief Stages the target gain of every channel, through the response
+     * curve; it is ramped to by the next ramp.
+     *
+     * @param newGain
+     */
+    void setGain(float newGain) noexcept;
+
+    /**
+     * @brief Stages the target gain of the `vector_type::size` channels
+     * starting at `channel`, through the response curve.
+     *
+     * @param channel
+     * @param newGain
+     */
+    STONEYVCV_ALWAYS_INLINE void setGain(::std::size_t channel, const vector_type &newGain) noexcept;
+
+    /**
+     * @brief Sets the gain of every channel to `newGain`, through the
+     * response curve, at once and with no ramp; for when there is no
+     * previous gain worth ramping from.
+     *
+     * @param newGain
+     */
+    void reset(float newGain) noexcept;
+
+    /**
+     * @brief Sets the number of samples over which each ramp runs, e.g. the
+     * control-rate division at which `setGain()` is called. Takes effect
+     * from the next ramp.
+     *
+     * @param numSamples At least `1`.
+     */
+    void setRampLength(::std::size_t numSamples) noexcept;
+
+    /**
+     * @brief Returns the gain of the `vector_type::size` channels starting at
+     * `channel`, as applied by the last call to `process()`.
+     *
+     * @param channel
+     */
+    vector_type getGain(::std::size_t channel) const noexcept;
+
+    /**
+     * @brief Returns the gain of every channel, e.g. for the per-voice
+     * lights.
+     *
+     */
+    const ::StoneyDSP::SIMD::PolyBuffer<float>& getGains() const noexcept;
+
+    /**
+     * @brief Selects the curve through which `setGain()` maps each control
+     * level to a gain; see `VCAEngine::applyResponse()`.
+     *
+     * @param newResponse
+     */
+    void setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept;
+
+    ::StoneyDSP::StoneyVCV::VCA::Response getResponse() const noexcept;
+
+    /**
+     * @brief Uses `kernels`' `Kernels::VCAGainKernel` from the next call to
+     * `process()`, or the `vector_type` code where it has none. Each bank
+     * starts with `Kernels::get()`'s.
+     *
+     * @param kernels
+     */
+    void setKernels(const ::StoneyDSP::StoneyVCV::Kernels::Table &kernels) noexcept;
+
+    //==========================================================================
+
+private:
+
+    //==========================================================================
+
+    /**
+     * @brief The gain of each channel, as applied by the last call to
+     * `process()`.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> gain;
+
+    /**
+     * @brief The gain of each channel staged by `setGain()`.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> target;
+
+    /**
+     * @brief The gain of each channel that the current ramp ends on; the
+     * targets staged when it started.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> end;
+
+    /**
+     * @brief The per-sample increment of each channel's gain in the current
+     * ramp.
+     *
+     */
+    ::StoneyDSP::SIMD::PolyBuffer<float> step;
+
+    /**
+     * @brief The samples left in the current ramp; the next ramp starts when
+     * it reaches `0`.
+     *
+     */
+    ::std::size_t remaining = 0U;
+
+    /**
+     * @brief The number of samples in each ramp.
+     *
+     */
+    ::std::size_t rampLength = 1U;
+
+    /**
+     * @brief The reciprocal of `rampLength`.
+     *
+     */
+    float rampReciprocal = 1.0F;
+
+    /**
+     * @brief The curve applied by `setGain()`, shared by every channel.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::VCA::Response response = ::StoneyDSP::StoneyVCV::VCA::Response::Linear;
+
+    /**
+     * @brief The selected kernel, or `nullptr` for the `vector_type` code.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Kernels::VCAGainKernel gainKernel = nullptr;
+
+    STONEYDSP_DECLARE_NON_COPYABLE(VCAEngineBank)
+    STONEYDSP_DECLARE_NON_MOVEABLE(VCAEngineBank)
+};
+
+//==============================================================================
+
 /**
  * @brief The `VCAModule` struct.
  *
@@ -172,9 +463,23 @@ public:
     enum IdxLights {
         //BLINK_LIGHT,
         ENUMS(BLINK_LIGHT, 2),
+        ENUMS(VOICE_LIGHTS, 16),
         NUM_LIGHTS
     };
 
+#if STONEYVCV_INSTRUMENTATION
+    enum IdxPaths {
+        IDLE_PATH,
+        OUTPUT_ONLY_PATH,
+        NO_CV_PATH,
+        CV_PATH,
+        CONTROL_RATE_PATH,
+        LIGHTS_PATH,
+        VOICE_LIGHTS_PATH,
+        NUM_PATHS
+    };
+#endif
+
     //==========================================================================
 
     /**
@@ -198,6 +503,45 @@ public:
      */
     virtual void process(const ::StoneyDSP::StoneyVCV::VCA::VCAModule::ProcessArgs &args) override;
 
+    /**
+     * @brief Called after a cable is connected to or disconnected from one of
+     * the module's ports; updates the cached `connections` mask.
+     *
+     * @param e
+     */
+    void onPortChange(const ::rack::engine::Module::PortChangeEvent &e) override;
+
+    /**
+     * @brief Called when the engine's sample rate changes, and when the
+     * module is added to the engine; rebuilds the cached `coefficients`.
+     *
+     * @param e
+     */
+    void onSampleRateChange(const ::rack::engine::Module::SampleRateChangeEvent &e) override;
+
+    /**
+     * @brief Store extra internal data in the "data" property of the module's JSON object.
+     *
+     * @return json_t
+     */
+    ::json_t *dataToJson() override;
+
+    /**
+     * @brief Load internal data from the "data" property of the module's JSON object.
+     * Not called if "data" property is not present.
+     *
+     * @param rootJ
+     */
+    void dataFromJson(::json_t *rootJ) override;
+
+    /**
+     * @brief Resets the params, then sets the gain coefficient straight to
+     * the knob.
+     *
+     * @param e
+     */
+    void onReset(const ::rack::engine::Module::ResetEvent &e) override;
+
     //==========================================================================
 
 	struct NumChannelsChangedEvent {};
@@ -234,6 +578,44 @@ public:
 
     ::rack::engine::Light &getBlinkLight() noexcept;
 
+    /**
+     * @brief Sets the number of samples between control-rate updates of the
+     * gain from the knob and CV, over which each update is ramped to.
+     *
+     * @param newDivision
+     */
+    void setControlRateDivision(::StoneyDSP::uint32_t newDivision) noexcept;
+
+    ::StoneyDSP::uint32_t getControlRateDivision() noexcept;
+
+    /**
+     * @brief Selects the curve through which the gain knob and CV are mapped
+     * to the applied gain.
+     *
+     * @param newResponse
+     */
+    void setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept;
+
+    ::StoneyDSP::StoneyVCV::VCA::Response getResponse() noexcept;
+
+    /**
+     * @brief Shows or hides the per-voice gain lights; while hidden, they
+     * cost nothing. The lights are cleared by the next call to `process()`.
+     *
+     * @param newVoiceLights
+     */
+    void setVoiceLights(bool newVoiceLights) noexcept;
+
+    bool getVoiceLights() noexcept;
+
+#if STONEYVCV_INSTRUMENTATION
+    /**
+     * @brief The cycles, channels and `IdxPaths` counted by `process()`.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Instrumentation &getInstrumentation() noexcept;
+#endif
+
     //==========================================================================
 
 private:
@@ -244,6 +626,34 @@ private:
 
     //==========================================================================
 
+    /**
+     * @brief The channel loop, over the first `numChannels` channels.
+     *
+     * @param numChannels
+     * @param controlRate Whether to stage the gain from the knob and CV,
+     * i.e. on the control-rate division.
+     */
+    void processChannels(::std::size_t numChannels, bool controlRate);
+
+    /**
+     * @brief Sets `gainCoefficient` straight to the `GAIN_PARAM` knob, and
+     * the gain of every channel to it, with no ramp; for when there is no
+     * previous value worth ramping from.
+     *
+     */
+    void resetGainCoefficient() noexcept;
+
+    /**
+     * @brief Sets the lights from the peak gain metered since the last call,
+     * and the per-voice lights from the gain of the first `numChannels`
+     * channels; called at the light rate, including while idle.
+     *
+     * @param numChannels
+     */
+    void processLights(::std::size_t numChannels);
+
+    //==========================================================================
+
     /**
      * @brief
      *
@@ -251,16 +661,74 @@ private:
     ::rack::dsp::ClockDivider lightDivider;
 
     /**
-     * @brief
+     * @brief Divides the sample rate down to the control rate, at which the
+     * `GAIN_PARAM` knob and the CV are read.
      *
      */
-    ::std::array<::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>, 16> engine;
+    ::rack::dsp::ClockDivider controlDivider;
 
     /**
-     * @brief
+     * @brief The per-sample constants derived from the sample rate and the
+     * dividers, read by `process()`.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Coefficients coefficients;
+
+    /**
+     * @brief The knob-derived gain coefficient, read at the control rate;
+     * the gain it stages is ramped to by `bank`.
      *
      */
-    ::std::array<float, 16> lightGains;
+    float gainCoefficient = 0.0F;
+
+    /**
+     * @brief One bit per connected port; inputs by `IdxInputs`, then outputs
+     * by `NUM_INPUTS + IdxOutputs`. Maintained by `onPortChange()` so that
+     * `process()` can select its fast path without querying the ports.
+     *
+     */
+    ::StoneyDSP::uint32_t connections = 0U;
+
+    using vector_type = ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::vector_type;
+
+    /**
+     * @brief The gain of every channel.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank bank;
+
+    /**
+     * @brief The peak gain of the active channels, for the lights.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::PeakMeter<vector_type> meter;
+
+    /**
+     * @brief The gain of each channel, for the per-voice lights.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::VoiceMeter<vector_type> voiceMeter;
+
+    /**
+     * @brief Whether the per-voice lights are shown.
+     *
+     */
+    ::std::atomic<bool> voiceLights;
+
+    /**
+     * @brief Set by `setVoiceLights()`, on the UI thread, so that the lights
+     * are cleared by `process()` rather than under its feet.
+     *
+     */
+    ::std::atomic<bool> voiceLightsResetRequested;
+
+#if STONEYVCV_INSTRUMENTATION
+    /**
+     * @brief The cost of each call to `process()`, and the paths it took.
+     *
+     */
+    ::StoneyDSP::StoneyVCV::Instrumentation instrumentation;
+#endif
 
     //==========================================================================
 
@@ -397,6 +865,13 @@ public:
      */
     virtual void draw(const ::StoneyDSP::StoneyVCV::VCA::VCAModuleWidget::DrawArgs &args) override;
 
+    /**
+     * @brief Adds the module's options to its context menu.
+     *
+     * @param menu
+     */
+    virtual void appendContextMenu(::rack::ui::Menu *menu) override;
+
     //==========================================================================
 
     /**
@@ -505,6 +980,12 @@ private:
      */
     ::rack::componentlibrary::MediumLight<::rack::componentlibrary::GreenRedLight> *vcaLight = NULL;
 
+    /**
+     * @brief 2mm LEDs showing each voice's gain, in two rows of eight.
+     *
+     */
+    ::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight> *voiceLights[16] = {};
+
     // ::rack::componentlibrary::MediumLight<::rack::componentlibrary::RedLight> *lightVca = NULL;
 
 
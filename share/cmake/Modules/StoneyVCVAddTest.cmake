@@ -115,3 +115,102 @@ function(stoneyvcv_add_test MODULE)
     message(STATUS "Added target: ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::tests_${MODULE} v${tests_${MODULE}_VERSION}")
 
 endfunction()
+
+function(stoneyvcv_add_render)
+
+    set(render_VERSION_MAJOR "${STONEYVCV_VERSION_MAJOR}")
+    set(render_VERSION_MINOR "${STONEYVCV_VERSION_MINOR}")
+    set(render_VERSION_PATCH "${STONEYVCV_VERSION_PATCH}")
+    set(render_VERSION "${render_VERSION_MAJOR}.${render_VERSION_MINOR}.${render_VERSION_PATCH}")
+
+    add_executable(render)
+    add_executable(StoneyVCV::render ALIAS render)
+    add_executable(${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::render ALIAS render)
+    target_include_directories(render
+        PUBLIC
+        $<BUILD_INTERFACE:${STONEYVCV_BINARY_DIR}/include>
+        $<INSTALL_INTERFACE:include>
+    )
+    target_sources(render
+        PRIVATE
+            "${STONEYVCV_SOURCE_DIR}/test/${STONEYVCV_SLUG}/render.cpp"
+    )
+    target_link_libraries(render
+        PUBLIC
+            unofficial-vcvrack::rack-sdk::lib
+            ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}
+            ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::plugin
+    )
+    set_target_properties(render
+        PROPERTIES
+        VERSION "${render_VERSION}"
+        SOVERSION "${render_VERSION_MAJOR}"
+        RUNTIME_OUTPUT_DIRECTORY "${STONEYVCV_BINARY_DIR}/test"
+        RUNTIME_OUTPUT_NAME "render"
+    )
+    target_compile_features(render PUBLIC cxx_std_17)
+    target_compile_features(render PUBLIC c_std_17)
+    target_compile_definitions(render
+        PUBLIC
+        "-Drender_VERSION_MAJOR=${render_VERSION_MAJOR}"
+        "-Drender_VERSION_MINOR=${render_VERSION_MINOR}"
+        "-Drender_VERSION_PATCH=${render_VERSION_PATCH}"
+        "-Drender_VERSION=${render_VERSION}"
+    )
+    set(render_VERSION_MAJOR "${STONEYVCV_VERSION_MAJOR}" PARENT_SCOPE)
+    set(render_VERSION_MINOR "${STONEYVCV_VERSION_MINOR}" PARENT_SCOPE)
+    set(render_VERSION_PATCH "${STONEYVCV_VERSION_PATCH}" PARENT_SCOPE)
+    set(render_VERSION "${render_VERSION_MAJOR}.${render_VERSION_MINOR}.${render_VERSION_PATCH}" PARENT_SCOPE)
+    message(STATUS "Added target: ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::render v${render_VERSION}")
+
+endfunction()
+
+function(stoneyvcv_add_benchmarks)
+
+    set(benchmarks_VERSION_MAJOR "${STONEYVCV_VERSION_MAJOR}")
+    set(benchmarks_VERSION_MINOR "${STONEYVCV_VERSION_MINOR}")
+    set(benchmarks_VERSION_PATCH "${STONEYVCV_VERSION_PATCH}")
+    set(benchmarks_VERSION "${benchmarks_VERSION_MAJOR}.${benchmarks_VERSION_MINOR}.${benchmarks_VERSION_PATCH}")
+
+    add_executable(benchmarks)
+    add_executable(StoneyVCV::benchmarks ALIAS benchmarks)
+    add_executable(${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::benchmarks ALIAS benchmarks)
+    target_include_directories(benchmarks
+        PUBLIC
+        $<BUILD_INTERFACE:${STONEYVCV_BINARY_DIR}/include>
+        $<INSTALL_INTERFACE:include>
+    )
+    target_sources(benchmarks
+        PRIVATE
+            "${STONEYVCV_SOURCE_DIR}/test/${STONEYVCV_SLUG}/benchmarks.cpp"
+    )
+    target_link_libraries(benchmarks
+        PUBLIC
+            unofficial-vcvrack::rack-sdk::lib
+            ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}
+            ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::plugin
+            Catch2::Catch2WithMain
+    )
+    set_target_properties(benchmarks
+        PROPERTIES
+        VERSION "${benchmarks_VERSION}"
+        SOVERSION "${benchmarks_VERSION_MAJOR}"
+        RUNTIME_OUTPUT_DIRECTORY "${STONEYVCV_BINARY_DIR}/test"
+        RUNTIME_OUTPUT_NAME "benchmarks"
+    )
+    target_compile_features(benchmarks PUBLIC cxx_std_17)
+    target_compile_features(benchmarks PUBLIC c_std_17)
+    target_compile_definitions(benchmarks
+        PUBLIC
+        "-Dbenchmarks_VERSION_MAJOR=${benchmarks_VERSION_MAJOR}"
+        "-Dbenchmarks_VERSION_MINOR=${benchmarks_VERSION_MINOR}"
+        "-Dbenchmarks_VERSION_PATCH=${benchmarks_VERSION_PATCH}"
+        "-Dbenchmarks_VERSION=${benchmarks_VERSION}"
+    )
+    set(benchmarks_VERSION_MAJOR "${STONEYVCV_VERSION_MAJOR}" PARENT_SCOPE)
+    set(benchmarks_VERSION_MINOR "${STONEYVCV_VERSION_MINOR}" PARENT_SCOPE)
+    set(benchmarks_VERSION_PATCH "${STONEYVCV_VERSION_PATCH}" PARENT_SCOPE)
+    set(benchmarks_VERSION "${benchmarks_VERSION_MAJOR}.${benchmarks_VERSION_MINOR}.${benchmarks_VERSION_PATCH}" PARENT_SCOPE)
+    message(STATUS "Added target: ${STONEYVCV_BRAND}::${STONEYVCV_SLUG}::benchmarks v${benchmarks_VERSION}")
+
+endfunction()
@@ -14,6 +14,11 @@
 
 //==============================================================================
 
+#include <algorithm>
+#include <limits>
+
+//==============================================================================
+
 namespace StoneyDSP {
 
 //==============================================================================
@@ -33,12 +38,227 @@ const ::StoneyDSP::float_t vBias = (0.0F);
 const ::StoneyDSP::float_t vGround = (0.0F);
 const ::StoneyDSP::float_t vFloor = (0.0F);
 
+const ::StoneyDSP::uint32_t controlRateDivisions[::StoneyDSP::StoneyVCV::Tools::numControlRateDivisions] = {
+    1U, 4U, 16U, 32U, 64U
+};
+const ::StoneyDSP::uint32_t controlRateDivision = (16U);
+
 //==============================================================================
 
 } // namespace Tools
 
 //==============================================================================
 
+void Coefficients::update(float newSampleRate, ::StoneyDSP::uint32_t lightDivision, ::StoneyDSP::uint32_t controlRateDivision) noexcept
+{
+    this->sampleRate = newSampleRate;
+    this->preciseSampleTime = 1.0 / static_cast<double>(newSampleRate);
+    this->sampleTime = static_cast<float>(this->preciseSampleTime);
+    this->lightDeltaTime = static_cast<float>(lightDivision) * this->sampleTime;
+    this->controlRateReciprocal = 1.0F / static_cast<float>(controlRateDivision);
+}
+
+//==============================================================================
+
+#if STONEYVCV_INSTRUMENTATION
+
+/**
+ * @brief The unit of `Instrumentation::now()`.
+ *
+ */
+#if STONEYDSP_INTEL
+static const char *const instrumentationUnit = "cycles";
+#else
+static const char *const instrumentationUnit = "ns";
+#endif
+
+Instrumentation::Instrumentation(const char *const *newPathNames, ::std::size_t newNumPaths) noexcept
+:   pathNames(newPathNames),
+    numPaths(::std::min(newNumPaths, ::StoneyDSP::StoneyVCV::Instrumentation::maxPaths)),
+    start(0U),
+    calls(0U),
+    cycles(0U),
+    voices(0U),
+    minCycles(0U),
+    maxCycles(0U),
+    channelCalls(),
+    channelCycles(),
+    pathCalls(),
+    resetRequested(false)
+{
+    this->clear();
+}
+
+void Instrumentation::reset() noexcept
+{
+    this->resetRequested.store(true, ::std::memory_order_relaxed);
+}
+
+void Instrumentation::clear() noexcept
+{
+    this->calls.store(0U, ::std::memory_order_relaxed);
+    this->cycles.store(0U, ::std::memory_order_relaxed);
+    this->voices.store(0U, ::std::memory_order_relaxed);
+    this->minCycles.store(::std::numeric_limits<::StoneyDSP::uint64_t>::max(), ::std::memory_order_relaxed);
+    this->maxCycles.store(0U, ::std::memory_order_relaxed);
+    for (auto &counter : this->channelCalls)
+        counter.store(0U, ::std::memory_order_relaxed);
+    for (auto &counter : this->channelCycles)
+        counter.store(0U, ::std::memory_order_relaxed);
+    for (auto &counter : this->pathCalls)
+        counter.store(0U, ::std::memory_order_relaxed);
+}
+
+Instrumentation::Snapshot Instrumentation::snapshot() const noexcept
+{
+    Instrumentation::Snapshot in;
+    in.calls = this->calls.load(::std::memory_order_relaxed);
+    in.cycles = this->cycles.load(::std::memory_order_relaxed);
+    in.voices = this->voices.load(::std::memory_order_relaxed);
+    in.minCycles = this->minCycles.load(::std::memory_order_relaxed);
+    in.maxCycles = this->maxCycles.load(::std::memory_order_relaxed);
+    for (::std::size_t channels = 0U; channels <= ::StoneyDSP::StoneyVCV::Instrumentation::maxChannels; channels++) {
+        in.channelCalls[channels] = this->channelCalls[channels].load(::std::memory_order_relaxed);
+        in.channelCycles[channels] = this->channelCycles[channels].load(::std::memory_order_relaxed);
+    }
+    for (::std::size_t path = 0U; path < ::StoneyDSP::StoneyVCV::Instrumentation::maxPaths; path++) {
+        in.pathCalls[path] = this->pathCalls[path].load(::std::memory_order_relaxed);
+    }
+    return in;
+}
+
+::json_t *Instrumentation::toJson() const
+{
+    const Instrumentation::Snapshot in = this->snapshot();
+    const double numCalls = static_cast<double>(in.calls);
+    const double numVoices = static_cast<double>(in.voices);
+
+    ::json_t *rootJ = ::json_object();
+    ::json_object_set_new(rootJ, "unit", ::json_string(instrumentationUnit));
+    ::json_object_set_new(rootJ, "calls", ::json_integer(static_cast<::json_int_t>(in.calls)));
+    ::json_object_set_new(rootJ, "cycles", ::json_integer(static_cast<::json_int_t>(in.cycles)));
+    ::json_object_set_new(rootJ, "voices", ::json_integer(static_cast<::json_int_t>(in.voices)));
+    ::json_object_set_new(rootJ, "minCycles", ::json_integer(in.calls > 0U ? static_cast<::json_int_t>(in.minCycles) : 0));
+    ::json_object_set_new(rootJ, "maxCycles", ::json_integer(static_cast<::json_int_t>(in.maxCycles)));
+    ::json_object_set_new(rootJ, "meanCyclesPerCall", ::json_real(numCalls > 0.0 ? static_cast<double>(in.cycles) / numCalls : 0.0));
+    ::json_object_set_new(rootJ, "meanCyclesPerVoice", ::json_real(numVoices > 0.0 ? static_cast<double>(in.cycles) / numVoices : 0.0));
+
+    // Only the channel counts that were seen; 0 is the idle calls
+    ::json_t *channelsJ = ::json_array();
+    for (::std::size_t channels = 0U; channels <= ::StoneyDSP::StoneyVCV::Instrumentation::maxChannels; channels++) {
+        if (in.channelCalls[channels] == 0U)
+            continue;
+        ::json_t *channelJ = ::json_object();
+        ::json_object_set_new(channelJ, "channels", ::json_integer(static_cast<::json_int_t>(channels)));
+        ::json_object_set_new(channelJ, "calls", ::json_integer(static_cast<::json_int_t>(in.channelCalls[channels])));
+        ::json_object_set_new(channelJ, "cycles", ::json_integer(static_cast<::json_int_t>(in.channelCycles[channels])));
+        ::json_object_set_new(channelJ, "meanCyclesPerCall", ::json_real(static_cast<double>(in.channelCycles[channels]) / static_cast<double>(in.channelCalls[channels])));
+        ::json_array_append_new(channelsJ, channelJ);
+    }
+    ::json_object_set_new(rootJ, "channels", channelsJ);
+
+    ::json_t *pathsJ = ::json_object();
+    for (::std::size_t path = 0U; path < this->numPaths; path++) {
+        ::json_object_set_new(pathsJ, this->pathNames[path], ::json_integer(static_cast<::json_int_t>(in.pathCalls[path])));
+    }
+    ::json_object_set_new(rootJ, "paths", pathsJ);
+
+    return rootJ;
+}
+
+#endif
+
+//==============================================================================
+
+::rack::ui::MenuItem *createControlRateMenuItem(
+    ::std::function<::StoneyDSP::uint32_t()> getter,
+    ::std::function<void(::StoneyDSP::uint32_t)> setter
+)
+{
+    ::std::vector<::std::string> labels;
+    for (const auto &division : ::StoneyDSP::StoneyVCV::Tools::controlRateDivisions) {
+        labels.push_back(division == 1U ? "Every sample" : ::rack::string::f("Every %u samples", division));
+    }
+
+    return ::rack::createIndexSubmenuItem(
+        "Control rate",
+        labels,
+        [=]() -> ::std::size_t {
+            const auto *begin = ::std::begin(::StoneyDSP::StoneyVCV::Tools::controlRateDivisions);
+            const auto *end = ::std::end(::StoneyDSP::StoneyVCV::Tools::controlRateDivisions);
+            return static_cast<::std::size_t>(::std::find(begin, end, getter()) - begin);
+        },
+        [=](::std::size_t index) {
+            setter(::StoneyDSP::StoneyVCV::Tools::controlRateDivisions[index]);
+        }
+    );
+}
+
+#if STONEYVCV_INSTRUMENTATION
+::rack::ui::MenuItem *createInstrumentationMenuItem(
+    ::StoneyDSP::StoneyVCV::Instrumentation *instrumentation
+)
+{
+    return ::rack::createSubmenuItem(
+        "Instrumentation",
+        "",
+        [=](::rack::ui::Menu *menu) {
+            const ::StoneyDSP::StoneyVCV::Instrumentation::Snapshot in = instrumentation->snapshot();
+            const double numCalls = static_cast<double>(in.calls);
+
+            menu->addChild(::rack::createMenuLabel(::rack::string::f("%llu calls", static_cast<unsigned long long>(in.calls))));
+            if (in.calls > 0U) {
+                menu->addChild(::rack::createMenuLabel(::rack::string::f(
+                    "%.0f %s/call (%llu..%llu)",
+                    static_cast<double>(in.cycles) / numCalls,
+                    instrumentationUnit,
+                    static_cast<unsigned long long>(in.minCycles),
+                    static_cast<unsigned long long>(in.maxCycles)
+                )));
+                if (in.voices > 0U) {
+                    menu->addChild(::rack::createMenuLabel(::rack::string::f(
+                        "%.1f %s/voice",
+                        static_cast<double>(in.cycles) / static_cast<double>(in.voices),
+                        instrumentationUnit
+                    )));
+                }
+
+                menu->addChild(new ::rack::ui::MenuSeparator);
+                for (::std::size_t channels = 0U; channels <= ::StoneyDSP::StoneyVCV::Instrumentation::maxChannels; channels++) {
+                    if (in.channelCalls[channels] == 0U)
+                        continue;
+                    // Idle calls process no channels
+                    const ::std::string label = channels == 0U ? "Idle"
+                        : channels == 1U ? "1 channel"
+                        : ::rack::string::f("%zu channels", channels);
+                    menu->addChild(::rack::createMenuLabel(::rack::string::f(
+                        "%s: %.1f%% of calls, %.0f %s/call",
+                        label.c_str(),
+                        100.0 * static_cast<double>(in.channelCalls[channels]) / numCalls,
+                        static_cast<double>(in.channelCycles[channels]) / static_cast<double>(in.channelCalls[channels]),
+                        instrumentationUnit
+                    )));
+                }
+
+                menu->addChild(new ::rack::ui::MenuSeparator);
+                for (::std::size_t path = 0U; path < instrumentation->numPaths; path++) {
+                    menu->addChild(::rack::createMenuLabel(::rack::string::f(
+                        "%s: %.1f%% of calls",
+                        instrumentation->pathNames[path],
+                        100.0 * static_cast<double>(in.pathCalls[path]) / numCalls
+                    )));
+                }
+            }
+
+            menu->addChild(new ::rack::ui::MenuSeparator);
+            menu->addChild(::rack::createMenuItem("Reset", "", [=]() { instrumentation->reset(); }));
+        }
+    );
+}
+#endif
+
+//==============================================================================
+
 } // namespace StoneyVCV
 
 //==============================================================================
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file src/StoneyVCV/Kernels.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @copyright Copyright (c) 2024 MIT License
+ *
+ ******************************************************************************/
+
+#include <StoneyVCV/Kernels.hpp>
+
+//==============================================================================
+
+#include <StoneyDSP/Core.hpp>
+
+//==============================================================================
+
+namespace StoneyDSP {
+
+//==============================================================================
+
+namespace StoneyVCV {
+
+//==============================================================================
+
+namespace Kernels {
+
+//==============================================================================
+
+/**
+ * @brief The baseline table; every engine uses its own `float_4` code.
+ *
+ */
+static const ::StoneyDSP::StoneyVCV::Kernels::Table baseline = {
+    ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::Baseline,
+    nullptr,
+    nullptr
+};
+
+/**
+ * @brief The table returned by `get()`; written once, by `select()` from
+ * `init()`, before any module is created.
+ *
+ */
+static const ::StoneyDSP::StoneyVCV::Kernels::Table *selected = &::StoneyDSP::StoneyVCV::Kernels::baseline;
+
+//==============================================================================
+
+const ::StoneyDSP::StoneyVCV::Kernels::Table &select() noexcept
+{
+    ::StoneyDSP::StoneyVCV::Kernels::selected = &::StoneyDSP::StoneyVCV::Kernels::baseline;
+
+    if (::StoneyDSP::StoneyVCV::Kernels::isSupported(::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2))
+        ::StoneyDSP::StoneyVCV::Kernels::selected = &::StoneyDSP::StoneyVCV::Kernels::get(::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2);
+    else if (::StoneyDSP::StoneyVCV::Kernels::isSupported(::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX))
+        ::StoneyDSP::StoneyVCV::Kernels::selected = &::StoneyDSP::StoneyVCV::Kernels::get(::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX);
+
+    return *::StoneyDSP::StoneyVCV::Kernels::selected;
+}
+
+const ::StoneyDSP::StoneyVCV::Kernels::Table &get() noexcept
+{
+    return *::StoneyDSP::StoneyVCV::Kernels::selected;
+}
+
+const ::StoneyDSP::StoneyVCV::Kernels::Table &get(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept
+{
+    switch (instructionSet) {
+#if STONEYVCV_DISPATCH
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2:
+        return ::StoneyDSP::StoneyVCV::Kernels::avx2;
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX:
+        return ::StoneyDSP::StoneyVCV::Kernels::avx;
+#endif
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::Baseline:
+    default:
+        return ::StoneyDSP::StoneyVCV::Kernels::baseline;
+    }
+}
+
+bool isSupported(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept
+{
+#if STONEYVCV_DISPATCH
+    // Also checks that the OS saves the AVX registers across context switches
+    __builtin_cpu_init();
+    switch (instructionSet) {
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX:
+        return __builtin_cpu_supports("avx");
+    default:
+        break;
+    }
+#endif
+    return instructionSet == ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::Baseline;
+}
+
+const char *getName(::StoneyDSP::StoneyVCV::Kernels::InstructionSet instructionSet) noexcept
+{
+    switch (instructionSet) {
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2:
+        return "AVX2";
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX:
+        return "AVX";
+    case ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::Baseline:
+    default:
+#if STONEYDSP_ARM
+        return "NEON";
+#else
+        return "SSE4.2";
+#endif
+    }
+}
+
+//==============================================================================
+
+} // namespace Kernels
+
+//==============================================================================
+
+} // namespace StoneyVCV
+
+//==============================================================================
+
+} // namespace StoneyDSP
+
+//==============================================================================
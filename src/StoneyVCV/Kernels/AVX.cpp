@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * @file src/StoneyVCV/Kernels/AVX.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @copyright Copyright (c) 2024 MIT License
+ *
+ ******************************************************************************/
+
+#include <StoneyVCV/Kernels.hpp>
+
+#if STONEYVCV_DISPATCH
+
+//==============================================================================
+
+#include <cstddef>
+#include <immintrin.h>
+
+//==============================================================================
+
+// Everything from here to the matching pop is compiled for AVX; nothing may
+// be included in between, so that no inline function of a shared header is
+// compiled for it.
+#if STONEYDSP_CLANG
+ #pragma clang attribute push (__attribute__((target("avx"))), apply_to = function)
+#else
+ #pragma GCC push_options
+ #pragma GCC target("avx")
+#endif
+
+namespace {
+#include "AVXKernels.inl"
+} // namespace
+
+#if STONEYDSP_CLANG
+ #pragma clang attribute pop
+#else
+ #pragma GCC pop_options
+#endif
+
+//==============================================================================
+
+const ::StoneyDSP::StoneyVCV::Kernels::Table StoneyDSP::StoneyVCV::Kernels::avx = {
+    ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX,
+    &::vcaGain,
+    &::lfoWaveforms
+};
+
+//==============================================================================
+
+#endif // STONEYVCV_DISPATCH
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * @file src/StoneyVCV/Kernels/AVX2.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @copyright Copyright (c) 2024 MIT License
+ *
+ ******************************************************************************/
+
+#include <StoneyVCV/Kernels.hpp>
+
+#if STONEYVCV_DISPATCH
+
+//==============================================================================
+
+#include <cstddef>
+#include <immintrin.h>
+
+//==============================================================================
+
+// As in `AVX.cpp`, with FMA: the compiler may fuse the kernels' multiplies
+// and adds, so their results can differ from the AVX ones in the last bit.
+#if STONEYDSP_CLANG
+ #pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+ #pragma GCC push_options
+ #pragma GCC target("avx2,fma")
+#endif
+
+namespace {
+#include "AVXKernels.inl"
+} // namespace
+
+#if STONEYDSP_CLANG
+ #pragma clang attribute pop
+#else
+ #pragma GCC pop_options
+#endif
+
+//==============================================================================
+
+const ::StoneyDSP::StoneyVCV::Kernels::Table StoneyDSP::StoneyVCV::Kernels::avx2 = {
+    ::StoneyDSP::StoneyVCV::Kernels::InstructionSet::AVX2,
+    &::vcaGain,
+    &::lfoWaveforms
+};
+
+//==============================================================================
+
+#endif // STONEYVCV_DISPATCH
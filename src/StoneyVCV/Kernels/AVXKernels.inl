@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * @file src/StoneyVCV/Kernels/AVXKernels.inl
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @copyright Copyright (c) 2024 MIT License
+ *
+ * The 8-wide kernels, shared by `AVX.cpp` and `AVX2.cpp`. Each includes this
+ * file inside an anonymous namespace and after its target pragma, so that
+ * every function here is compiled for that file's instruction set and has
+ * internal linkage. The helpers below mirror `SIMD::foldPhase()`,
+ * `SIMD::sinFolded()` and the `DSP::polyBlep*()` functions, whose own code
+ * is compiled for the baseline.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+/**
+ * @brief The number of channels held by every buffer passed to a kernel.
+ *
+ */
+constexpr ::std::size_t maxChannels = 16U;
+
+/**
+ * @brief The number of channels in one `__m256`.
+ *
+ */
+constexpr ::std::size_t lanes = 8U;
+
+//==============================================================================
+
+inline __m256 floor8(__m256 x) noexcept
+{
+    return _mm256_round_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+
+inline __m256 fabs8(__m256 x) noexcept
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0F), x);
+}
+
+inline __m256 ifelse8(__m256 mask, __m256 a, __m256 b) noexcept
+{
+    return _mm256_blendv_ps(b, a, mask);
+}
+
+/**
+ * @brief As `SIMD::foldPhase()`.
+ *
+ */
+inline __m256 foldPhase8(__m256 phase) noexcept
+{
+    __m256 t = _mm256_add_ps(phase, _mm256_set1_ps(0.25F));
+    t = _mm256_sub_ps(t, ::floor8(t));
+    return _mm256_sub_ps(
+        _mm256_set1_ps(1.0F),
+        _mm256_mul_ps(_mm256_set1_ps(4.0F), ::fabs8(_mm256_sub_ps(t, _mm256_set1_ps(0.5F))))
+    );
+}
+
+/**
+ * @brief As `SIMD::sinFolded()`, at its default `SineAccuracy::Medium`.
+ *
+ */
+inline __m256 sinFolded8(__m256 t) noexcept
+{
+    const __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 y = _mm256_set1_ps(static_cast<float>(-0.0043330952931384123));
+    y = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(0.079434344617870481)), _mm256_mul_ps(t2, y));
+    y = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(-0.64589284954879100)), _mm256_mul_ps(t2, y));
+    y = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(1.5707910110756262)), _mm256_mul_ps(t2, y));
+    return _mm256_mul_ps(t, y);
+}
+
+/**
+ * @brief As `DSP::polyBlep()`.
+ *
+ */
+inline __m256 polyBlep8(__m256 t, __m256 dt) noexcept
+{
+    const __m256 one = _mm256_set1_ps(1.0F);
+    // Just after the discontinuity
+    const __m256 x0 = _mm256_div_ps(t, dt);
+    const __m256 after = _mm256_sub_ps(_mm256_sub_ps(_mm256_add_ps(x0, x0), _mm256_mul_ps(x0, x0)), one);
+    // Just before the discontinuity
+    const __m256 x1 = _mm256_div_ps(_mm256_sub_ps(t, one), dt);
+    const __m256 before = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x1, x1), x1), x1), one);
+
+    return ::ifelse8(
+        _mm256_cmp_ps(t, dt, _CMP_LT_OQ),
+        after,
+        ::ifelse8(_mm256_cmp_ps(t, _mm256_sub_ps(one, dt), _CMP_GT_OQ), before, _mm256_setzero_ps())
+    );
+}
+
+/**
+ * @brief As `DSP::polyBlepSaw()`.
+ *
+ */
+inline __m256 polyBlepSaw8(__m256 phase, __m256 dt) noexcept
+{
+    const __m256 naive = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0F), phase), _mm256_set1_ps(1.0F));
+    return _mm256_sub_ps(naive, ::polyBlep8(phase, dt));
+}
+
+/**
+ * @brief As `DSP::polyBlepPulse()`.
+ *
+ */
+inline __m256 polyBlepPulse8(__m256 phase, __m256 dt, __m256 width) noexcept
+{
+    const __m256 naive = ::ifelse8(_mm256_cmp_ps(phase, width, _CMP_LT_OQ), _mm256_set1_ps(1.0F), _mm256_set1_ps(-1.0F));
+    // The falling edge, at `phase == width`
+    __m256 fall = _mm256_sub_ps(phase, width);
+    fall = _mm256_sub_ps(fall, ::floor8(fall));
+    return _mm256_sub_ps(_mm256_add_ps(naive, ::polyBlep8(phase, dt)), ::polyBlep8(fall, dt));
+}
+
+//==============================================================================
+
+/**
+ * @brief See `Kernels::VCAGainKernel`.
+ *
+ */
+void vcaGain(const float *input, float *output, float *gain, const float *step, ::std::size_t numChannels)
+{
+    for (::std::size_t channel = 0U; channel < maxChannels; channel += lanes) {
+        const __m256 g = _mm256_add_ps(_mm256_loadu_ps(gain + channel), _mm256_loadu_ps(step + channel));
+        _mm256_storeu_ps(gain + channel, g);
+        if (channel < numChannels)
+            _mm256_storeu_ps(output + channel, _mm256_mul_ps(_mm256_loadu_ps(input + channel), g));
+    }
+}
+
+/**
+ * @brief See `Kernels::LFOWaveformsKernel`.
+ *
+ */
+void lfoWaveforms(const float *phase, const float *frequency, const float *pulseWidth, float sampleTime, float *sin, float *tri, float *saw, float *sqr, ::std::size_t numChannels)
+{
+    const __m256 deltaTime = _mm256_set1_ps(sampleTime);
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += lanes) {
+        const __m256 p = _mm256_loadu_ps(phase + channel);
+
+        // The phase increment, for the PolyBLEP corrections
+        const __m256 dt = ::fabs8(_mm256_mul_ps(_mm256_loadu_ps(frequency + channel), deltaTime));
+
+        // Triangle, in phase with the sine
+        const __m256 t = ::foldPhase8(p);
+        _mm256_storeu_ps(tri + channel, t);
+
+        // Sine, shaped directly from the triangle
+        _mm256_storeu_ps(sin + channel, ::sinFolded8(t));
+
+        // Rising sawtooth, band-limited
+        _mm256_storeu_ps(saw + channel, ::polyBlepSaw8(p, dt));
+
+        // Square, high for the first `pulseWidth` of the period, band-limited
+        _mm256_storeu_ps(sqr + channel, ::polyBlepPulse8(p, dt, _mm256_loadu_ps(pulseWidth + channel)));
+    }
+}
+
+//==============================================================================
@@ -19,6 +19,7 @@
 #include <StoneyVCV/ComponentLibrary/ParamWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/PanelWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/RoundKnobWidget.hpp>
+#include <StoneyVCV/Kernels.hpp>
 
 //==============================================================================
 
@@ -56,6 +57,21 @@ static const ::rack::math::Vec LFODimensions = ::rack::math::Vec(
 
 //==============================================================================
 
+#if STONEYVCV_INSTRUMENTATION
+static const char *const pathNames[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::NUM_PATHS] = {
+    "Idle",
+    "Control-rate update",
+    "FM",
+    "Clocked",
+    "PWM",
+    "Double-precision phase",
+    "Lights",
+    "Voice lights"
+};
+#endif
+
+//==============================================================================
+
 } // namespace LFO
 } // namespace StoneyVCV
 } // namespace StoneyDSP
@@ -64,22 +80,30 @@ static const ::rack::math::Vec LFODimensions = ::rack::math::Vec(
 
 template <typename T>
 ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::LFOEngine()
-:   frequency(static_cast<T>(2.0)),
+:   ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>>(),
+    oscillator(),
     lastFrequency(static_cast<T>(2.0)),
-    phase(static_cast<T>(0.0))
+    pulseWidth(static_cast<T>(0.5)),
+    sampleTime(static_cast<T>(1.0 / 44100.0))
 {
     // Assertions
     DBG("Constructing StoneyVCV::LFO::LFOEngine");
+
+    this->oscillator.freq = static_cast<T>(2.0);
 }
 
 template <typename T>
 ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::LFOEngine(T newFrequency)
-:   frequency(newFrequency),
+:   ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>>(),
+    oscillator(),
     lastFrequency(newFrequency),
-    phase(static_cast<T>(0.0))
+    pulseWidth(static_cast<T>(0.5)),
+    sampleTime(static_cast<T>(1.0 / 44100.0))
 {
     // Assertions
     DBG("Constructing StoneyVCV::LFO::LFOEngine");
+
+    this->oscillator.freq = newFrequency;
 }
 
 template <typename T>
@@ -88,47 +112,281 @@ template <typename T>
     // Assertions
     DBG("Destroying StoneyVCV::LFO::LFOEngine");
 
-    this->frequency = static_cast<T>(2.0);
-    this->phase = static_cast<T>(0.0);
+    this->oscillator.freq = static_cast<T>(2.0);
+    this->oscillator.reset();
 }
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::processSample(T* sample)
 {
-    // We can pass in an owned pointer-to-float, and write the phase to it
-    ::StoneyDSP::ignoreUnused(sample);
+    *sample = this->oscillator.process(this->sampleTime);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::processSample(T *sin, T *tri, T *saw, T *sqr)
+{
+    // One phase update feeds all four waveforms
+    this->processWaveforms(this->oscillator.process(this->sampleTime), sin, tri, saw, sqr);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::processSample(const T &phase, T *sin, T *tri, T *saw, T *sqr)
+{
+    this->processWaveforms(this->oscillator.setPhase(phase, this->sampleTime), sin, tri, saw, sqr);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::processWaveforms(const T &phase, T *sin, T *tri, T *saw, T *sqr)
+{
+    // Triangle, in phase with the sine
+    const T t = ::StoneyDSP::SIMD::foldPhase(phase);
+    *tri = t;
+
+    // Sine, starting at 0 and rising. The triangle is the sine's phase folded
+    // into [-1, 1], so it is shaped directly rather than folded again.
+    *sin = ::StoneyDSP::SIMD::sinFolded(t);
+
+    // Rising sawtooth, band-limited
+    *saw = this->oscillator.saw();
+
+    // Square, high for the first `pulseWidth` of the period, band-limited
+    *sqr = this->oscillator.pulse(this->pulseWidth);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::processSamples(T *output, ::std::size_t numSamples, const T &targetFrequency)
+{
+    if (numSamples == 0U) {
+        this->setFrequency(targetFrequency);
+        return;
+    }
+
+    T &frequency = this->oscillator.freq;
+    const T step = (targetFrequency - frequency) / static_cast<T>(numSamples);
+
+    for (::std::size_t i = 0U; i < numSamples; ++i) {
+        frequency += step;
+        this->processSample(&output[i]);
+    }
+
+    this->lastFrequency = frequency;
+    frequency = targetFrequency;
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::reset() noexcept
+{
+    this->oscillator.reset();
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::reset(const T &mask) noexcept
+{
+    this->oscillator.reset(mask);
+}
+
+template <typename T>
+T StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::sync(const T &input) noexcept
+{
+    return this->oscillator.sync(input, static_cast<T>(0.1F), static_cast<T>(2.0F));
 }
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::setFrequency(const T &newFrequency)
 {
-    this->frequency = newFrequency;
+    this->lastFrequency = this->oscillator.freq;
+    this->oscillator.freq = newFrequency;
 }
 
 template <typename T>
 T& ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::getFrequency() noexcept
 {
-    return this->frequency;
+    return this->oscillator.freq;
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::setPulseWidth(const T &newPulseWidth)
+{
+    this->pulseWidth = newPulseWidth;
+}
+
+template <typename T>
+T& ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::getPulseWidth() noexcept
+{
+    return this->pulseWidth;
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngine<T>::setSampleTime(const T &newSampleTime)
+{
+    this->sampleTime = newSampleTime;
 }
 
 template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<float>;
 template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<double>;
-// template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::rack::simd::float_4>;
-// template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::StoneyDSP::SIMD::double_2>;
+template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::StoneyDSP::SIMD::double_2>;
+template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::StoneyDSP::SIMD::float_4>;
+
+//==============================================================================
+
+::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::LFOEngineBank()
+:   frequency(2.0F),
+    pulseWidth(0.5F),
+    resetting(0.0F),
+    syncInput(0.0F),
+    sin(0.0F),
+    tri(0.0F),
+    saw(0.0F),
+    sqr(0.0F),
+    phaseDrivers(),
+    precisePhaseDrivers(),
+    shaper(),
+    phase(0.0F),
+    waveformsKernel(::StoneyDSP::StoneyVCV::Kernels::get().lfoWaveforms),
+    doublePrecisionPhase(false)
+{
+    DBG("Constructing StoneyVCV::LFO::LFOEngineBank");
+}
+
+::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::~LFOEngineBank() noexcept
+{
+    DBG("Destroying StoneyVCV::LFO::LFOEngineBank");
+
+    this->frequency.fill(0.0F);
+    this->reset();
+}
+
+STONEYVCV_ALWAYS_INLINE void ::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::process(double sampleTime, ::std::size_t numChannels) noexcept
+{
+    using float_4 = ::StoneyDSP::SIMD::float_4;
+    using double_2 = ::StoneyDSP::SIMD::double_2;
+
+    const float_4 deltaTime = static_cast<float>(sampleTime);
+    const double_2 preciseDeltaTime = sampleTime;
+    this->shaper.setSampleTime(deltaTime);
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += float_4::size) {
+
+        auto &phaseDriver = this->phaseDrivers[channel / float_4::size];
+        const float_4 f = this->frequency.load<float_4>(channel);
+
+        // Hard sync on a rising edge at the sync input, or a reset. The
+        // single precision driver's trigger is kept in either mode, so that
+        // changing modes doesn't lose an edge.
+        const float_4 resets = this->resetting.load<float_4>(channel) + phaseDriver.sync(this->syncInput.load<float_4>(channel));
+
+        float_4 p;
+        if (this->doublePrecisionPhase) {
+            // Only the wrapped phase is narrowed to float, never the sum
+            auto &lo = this->precisePhaseDrivers[channel / double_2::size];
+            auto &hi = this->precisePhaseDrivers[channel / double_2::size + 1U];
+            lo.reset(double_2(resets) > 0.0);
+            hi.reset(double_2::convertHigh(resets) > 0.0);
+            lo.freq = double_2(f);
+            hi.freq = double_2::convertHigh(f);
+            p = float_4(lo.process(preciseDeltaTime), hi.process(preciseDeltaTime));
+        } else {
+            phaseDriver.reset(resets > 0.0F);
+            phaseDriver.freq = f;
+            p = phaseDriver.process(deltaTime);
+        }
+
+        if (this->waveformsKernel != nullptr) {
+            this->phase.store(channel, p);
+            continue;
+        }
+
+        // All four waveforms, from the one phase
+        float_4 sinValue, triValue, sawValue, sqrValue;
+        this->shaper.setFrequency(f);
+        this->shaper.setPulseWidth(this->pulseWidth.load<float_4>(channel));
+        this->shaper.processSample(p, &sinValue, &triValue, &sawValue, &sqrValue);
+        this->sin.store(channel, sinValue);
+        this->tri.store(channel, triValue);
+        this->saw.store(channel, sawValue);
+        this->sqr.store(channel, sqrValue);
+    }
+
+    // All four waveforms of every voice, from their phases, 8 at a time
+    if (this->waveformsKernel != nullptr) {
+        this->waveformsKernel(this->phase.data(), this->frequency.data(), this->pulseWidth.data(), static_cast<float>(sampleTime), this->sin.data(), this->tri.data(), this->saw.data(), this->sqr.data(), numChannels);
+    }
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::reset() noexcept
+{
+    for (auto &phaseDriver : this->phaseDrivers)
+        phaseDriver.reset();
+    for (auto &phaseDriver : this->precisePhaseDrivers)
+        phaseDriver.reset();
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::setDoublePrecisionPhase(bool newDoublePrecisionPhase) noexcept
+{
+    using double_2 = ::StoneyDSP::SIMD::double_2;
+
+    if (newDoublePrecisionPhase == this->doublePrecisionPhase)
+        return;
+
+    // Carry the live phase over into the other drivers, which have been left
+    // where they were when the mode last changed
+    for (::std::size_t i = 0U; i < this->phaseDrivers.size(); ++i) {
+        auto &phaseDriver = this->phaseDrivers[i];
+        auto &lo = this->precisePhaseDrivers[2U * i];
+        auto &hi = this->precisePhaseDrivers[2U * i + 1U];
+        if (newDoublePrecisionPhase) {
+            lo.phase = double_2(phaseDriver.phase);
+            hi.phase = double_2::convertHigh(phaseDriver.phase);
+        } else {
+            phaseDriver.phase = ::StoneyDSP::SIMD::float_4(lo.phase, hi.phase);
+        }
+    }
+
+    this->doublePrecisionPhase = newDoublePrecisionPhase;
+}
+
+bool StoneyDSP::StoneyVCV::LFO::LFOEngineBank::getDoublePrecisionPhase() const noexcept
+{
+    return this->doublePrecisionPhase;
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOEngineBank::setKernels(const ::StoneyDSP::StoneyVCV::Kernels::Table &kernels) noexcept
+{
+    this->waveformsKernel = kernels.lfoWaveforms;
+}
 
 //==============================================================================
 
 ::StoneyDSP::StoneyVCV::LFO::LFOModule::LFOModule()
 :   lightDivider(),
-    engine(),
-    lightGains{0.0F}
+    controlDivider(),
+    coefficients(),
+    frequencyCoefficient(2.0F),
+    frequencyCoefficientStep(0.0F),
+    pulseWidthCoefficient(0.5F),
+    pulseWidthCoefficientStep(0.0F),
+    fmAmount(0.0F),
+    pwmAmount(0.0F),
+    connections(0U),
+    bank(),
+    clockTriggers(),
+    clockTimers{0.0F},
+    clockTimed{false},
+    clockFrequencies{0.0F},
+    meter(),
+    voiceMeter(),
+    voiceLights(false),
+    voiceLightsResetRequested(false)
+#if STONEYVCV_INSTRUMENTATION
+    , instrumentation(::StoneyDSP::StoneyVCV::LFO::pathNames, ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::NUM_PATHS)
+#endif
 {
     // Assertions
     DBG("Constructing StoneyVCV::LFO::LFOModule");
     assert(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxParams::NUM_PARAMS == 4U);
     assert(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::NUM_INPUTS == 4U);
     assert(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::NUM_OUTPUTS == 4U);
-    assert(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::NUM_LIGHTS == 2U);
+    assert(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::NUM_LIGHTS == 18U);
 
     // Configure the number of Params, Outputs, Inputs, and Lights.
     this->config(
@@ -210,54 +468,324 @@ template struct ::StoneyDSP::StoneyVCV::LFO::LFOEngine<double>;
         "Square"                                                                // name
     );
     this->lightDivider.setDivision(16);
-    for(auto &e : this->engine) {
-        e.setFrequency(2.0F);
-    }
+    this->controlDivider.setDivision(::StoneyDSP::StoneyVCV::Tools::controlRateDivision);
+    this->coefficients.update(this->coefficients.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+
+    this->bank.frequency.fill(2.0F);
 }
 
 ::StoneyDSP::StoneyVCV::LFO::LFOModule::~LFOModule() noexcept
 {
     DBG("Destroying StoneyVCV::LFO::LFOModule");
 
-    for(auto &e : this->engine) {
-        e.setFrequency(0.0F);
+    this->bank.frequency.fill(0.0F);
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::process(const ::StoneyDSP::StoneyVCV::LFO::LFOModule::ProcessArgs &args)
+{
+    auto &fm_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::FM_INPUT];
+    auto &clk_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT];
+    auto &rst_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::RST_INPUT];
+    auto &pwm_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::PWM_INPUT];
+    auto &sin_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SIN_OUTPUT];
+    auto &tri_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::TRI_OUTPUT];
+    auto &saw_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SAW_OUTPUT];
+    auto &sqr_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SQR_OUTPUT];
+
+    static constexpr ::StoneyDSP::uint32_t outputsConnected = ((1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::NUM_OUTPUTS) - 1U) << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::NUM_INPUTS;
+
+    STONEYVCV_INSTRUMENT(this->instrumentation.begin());
+
+    static constexpr ::StoneyDSP::uint32_t clockConnected = 1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT;
+
+    // Fully idle; with no outputs patched, nothing can hear the LFO, but a
+    // patched clock is still timed, so that its rate is known once an
+    // output is patched again, and the lights fade out
+    if ((this->connections & outputsConnected) == 0U) {
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::IDLE_PATH));
+        if ((this->connections & clockConnected) != 0U) {
+            const ::std::size_t numClockChannels = ::std::max<::std::size_t>(1U, static_cast<unsigned int>(clk_input.getChannels()));
+            for (::std::size_t channel = 0U; channel < numClockChannels; channel++) {
+                this->processClock(channel, clk_input.getPolyVoltage(channel));
+            }
+        }
+        if (this->lightDivider.process()) {
+            this->processLights(0U);
+        }
+        STONEYVCV_INSTRUMENT(this->instrumentation.end(0U));
+        return;
+    }
+
+    // Panel-based params are monophonic by nature, nor do they change at
+    // audio rate; so only derive the knobs' frequency and pulse width at the
+    // control rate, and ramp towards them over one division
+    if (this->controlDivider.process()) {
+        const float targetFrequency = ::std::exp2(this->params[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxParams::FREQ_PARAM].getValue());
+        const float targetPulseWidth = this->params[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxParams::PWM_PARAM].getValue() * 0.1F;
+        this->frequencyCoefficientStep = (targetFrequency - this->frequencyCoefficient) * this->coefficients.controlRateReciprocal;
+        this->pulseWidthCoefficientStep = (targetPulseWidth - this->pulseWidthCoefficient) * this->coefficients.controlRateReciprocal;
+        // Trimpots are -5..5, i.e. -100%..100%
+        this->fmAmount = this->params[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxParams::TRIMPOT_FM_PARAM].getValue() * 0.2F;
+        this->pwmAmount = this->params[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxParams::TRIMPOT_PWM_PARAM].getValue() * 0.2F;
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::CONTROL_RATE_PATH));
     }
+    this->frequencyCoefficient += this->frequencyCoefficientStep;
+    this->pulseWidthCoefficient += this->pulseWidthCoefficientStep;
+
+    // Get desired number of channels from the inputs; if they are all
+    // unpatched, we should still generate 1 channel of output.
+    ::std::size_t numChannels = ::std::max<::std::size_t>({
+        1U,
+        static_cast<unsigned int>(fm_input.getChannels()),
+        static_cast<unsigned int>(clk_input.getChannels()),
+        static_cast<unsigned int>(rst_input.getChannels()),
+        static_cast<unsigned int>(pwm_input.getChannels())
+    });
+
+#if STONEYVCV_INSTRUMENTATION
+    // The channel loop's optional work, by what is patched
+    if ((this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::FM_INPUT)) != 0U)
+        this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::FM_PATH);
+    if ((this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT)) != 0U)
+        this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::CLOCK_PATH);
+    if ((this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::PWM_INPUT)) != 0U)
+        this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::PWM_PATH);
+    if (this->bank.getDoublePrecisionPhase())
+        this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::DOUBLE_PRECISION_PATH);
+#endif
+
+    this->processChannels(numChannels);
+
+    sin_output.setChannels(numChannels);
+    tri_output.setChannels(numChannels);
+    saw_output.setChannels(numChannels);
+    sqr_output.setChannels(numChannels);
 
-    for(auto &lightGain : this->lightGains) {
-        lightGain = (0.0F);
+    // Lights
+    if (this->lightDivider.process()) {
+        this->processLights(numChannels);
     }
+
+    STONEYVCV_INSTRUMENT(this->instrumentation.end(numChannels));
 }
 
-void ::StoneyDSP::StoneyVCV::LFO::LFOModule::process(const ::StoneyDSP::StoneyVCV::LFO::LFOModule::ProcessArgs &args)
+STONEYVCV_ALWAYS_INLINE bool StoneyDSP::StoneyVCV::LFO::LFOModule::processClock(::std::size_t channel, float voltage)
+{
+    this->clockTimers[channel] += this->coefficients.sampleTime;
+    if (this->clockTriggers[channel].process(voltage, 0.1F, 2.0F)) {
+        if (this->clockTimed[channel])
+            this->clockFrequencies[channel] = 1.0F / this->clockTimers[channel];
+        this->clockTimed[channel] = true;
+        this->clockTimers[channel] = 0.0F;
+        return true;
+    }
+    return false;
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::processChannels(::std::size_t numChannels)
+{
+    auto &fm_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::FM_INPUT];
+    auto &clk_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT];
+    auto &rst_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::RST_INPUT];
+    auto &pwm_input = this->inputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::PWM_INPUT];
+    auto &sin_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SIN_OUTPUT];
+    auto &tri_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::TRI_OUTPUT];
+    auto &saw_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SAW_OUTPUT];
+    auto &sqr_output = this->outputs[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SQR_OUTPUT];
+
+    const bool clocked = (this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT)) != 0U;
+    const bool modulated = (this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::FM_INPUT)) != 0U;
+    const bool pulseWidthModulated = (this->connections & (1U << ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::PWM_INPUT)) != 0U;
+
+    // Without PWM, the pulse width is the same for every channel
+    const float knobPulseWidth = ::rack::clamp(this->pulseWidthCoefficient, 0.01F, 0.99F);
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += 4U) {
+
+        // Frequency modulation, in V/Oct about the knob
+        const ::StoneyDSP::SIMD::float_4 pitch = fm_input.getPolyVoltageSimd<::StoneyDSP::SIMD::float_4>(channel) * this->fmAmount;
+        ::StoneyDSP::SIMD::float_4 frequency = this->frequencyCoefficient;
+        if (modulated) {
+            frequency *= ::StoneyDSP::SIMD::exp2(pitch);
+        }
+
+        // Clock edges are detected (and the clock timed) per channel, then
+        // applied to the whole group at once as a lane mask
+        ::StoneyDSP::SIMD::float_4 resetting = 0.0F;
+
+        for (::std::size_t lane = 0U; lane < 4U; lane++) {
+
+            const auto c = channel + lane;
+
+            // When clocked, the knob's default position follows the clock rate
+            if (clocked && this->processClock(c, clk_input.getPolyVoltage(c))) {
+                resetting[lane] = 1.0F;
+            }
+
+            if (clocked && this->clockFrequencies[c] > 0.0F) {
+                frequency[lane] *= this->clockFrequencies[c] * 0.5F;
+            }
+        }
+
+        // Pulse width, as 0..1
+        ::StoneyDSP::SIMD::float_4 pulseWidth = knobPulseWidth;
+        if (pulseWidthModulated) {
+            pulseWidth = ::StoneyDSP::SIMD::clamp(this->pulseWidthCoefficient + (pwm_input.getPolyVoltageSimd<::StoneyDSP::SIMD::float_4>(channel) * this->pwmAmount * 0.1F), 0.01F, 0.99F);
+        }
+
+        // Stage the group's voices; the reset input hard syncs them
+        this->bank.frequency.store(channel, frequency);
+        this->bank.pulseWidth.store(channel, pulseWidth);
+        this->bank.resetting.store(channel, resetting);
+        this->bank.syncInput.store(channel, rst_input.getPolyVoltageSimd<::StoneyDSP::SIMD::float_4>(channel));
+    }
+
+    // Every active voice at once
+    this->bank.process(this->coefficients.preciseSampleTime, numChannels);
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += 4U) {
+
+        const auto sin = this->bank.sin.load<::StoneyDSP::SIMD::float_4>(channel);
+
+        sin_output.setVoltageSimd(sin * 5.0F, channel);
+        tri_output.setVoltageSimd(this->bank.tri.load<::StoneyDSP::SIMD::float_4>(channel) * 5.0F, channel);
+        saw_output.setVoltageSimd(this->bank.saw.load<::StoneyDSP::SIMD::float_4>(channel) * 5.0F, channel);
+        sqr_output.setVoltageSimd(this->bank.sqr.load<::StoneyDSP::SIMD::float_4>(channel) * 5.0F, channel);
+
+        this->meter.process((sin * 0.5F) + 0.5F, channel, numChannels);
+    }
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::processLights(::std::size_t numChannels)
 {
     auto &blink_light0 = this->lights[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::BLINK_LIGHT + 0];
     auto &blink_light1 = this->lights[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::BLINK_LIGHT + 1];
 
-    // Lights
-    if (this->lightDivider.process()) {
-        auto lightValue = *::std::max_element<StoneyDSP::float_t *>(this->lightGains.begin(), this->lightGains.end());
-        blink_light0.setBrightnessSmooth(
-            1 - (lightValue * lightValue),
-            this->lightDivider.getDivision() * args.sampleTime
-        );
-        blink_light1.setBrightnessSmooth(
-            (lightValue * lightValue),
-            this->lightDivider.getDivision() * args.sampleTime
+    STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::LIGHTS_PATH));
+    // The peak of the active channels' sines over the last block
+    const float lightValue = this->meter.flush();
+    blink_light0.setBrightnessSmooth(
+        numChannels > 0U ? 1 - (lightValue * lightValue) : 0.0F,
+        this->coefficients.lightDeltaTime
+    );
+    blink_light1.setBrightnessSmooth(
+        (lightValue * lightValue),
+        this->coefficients.lightDeltaTime
+    );
+    if (this->voiceLightsResetRequested.load(::std::memory_order_relaxed)) {
+        this->voiceMeter.reset(&this->lights[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::VOICE_LIGHTS]);
+        this->voiceLightsResetRequested.store(false, ::std::memory_order_relaxed);
+    }
+    if (this->voiceLights.load(::std::memory_order_relaxed)) {
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxPaths::VOICE_LIGHTS_PATH));
+        // Sines are -1..1
+        this->voiceMeter.process(
+            this->bank.sin,
+            numChannels,
+            this->coefficients.lightDeltaTime,
+            &this->lights[::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::VOICE_LIGHTS],
+            0.5F,
+            0.5F
         );
     }
 }
 
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::onPortChange(const ::rack::engine::Module::PortChangeEvent &e)
+{
+    const auto bit = (e.type == ::rack::engine::Port::INPUT)
+        ? static_cast<::StoneyDSP::uint32_t>(e.portId)
+        : static_cast<::StoneyDSP::uint32_t>(::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::NUM_INPUTS + e.portId);
+
+    if (e.connecting)
+        this->connections |= (1U << bit);
+    else
+        this->connections &= ~(1U << bit);
+
+    // A clock, newly patched or unpatched, is timed afresh; the time since
+    // the last edge of any previous clock is not its period
+    if (bit == ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxInputs::CLK_INPUT) {
+        for (auto &trigger : this->clockTriggers)
+            trigger.reset();
+        this->clockTimers.fill(0.0F);
+        this->clockTimed.fill(false);
+        this->clockFrequencies.fill(0.0F);
+    }
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::onSampleRateChange(const ::rack::engine::Module::SampleRateChangeEvent &e)
+{
+    this->coefficients.update(e.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+}
+
 ::json_t *::StoneyDSP::StoneyVCV::LFO::LFOModule::dataToJson()
 {
     ::json_t *rootJ = ::json_object();
+    ::json_object_set_new(rootJ, "controlRateDivision", ::json_integer(this->getControlRateDivision()));
+    ::json_object_set_new(rootJ, "doublePrecisionPhase", ::json_boolean(this->getDoublePrecisionPhase()));
+    ::json_object_set_new(rootJ, "voiceLights", ::json_boolean(this->getVoiceLights()));
+#if STONEYVCV_INSTRUMENTATION
+    // Written for inspection only; never read back
+    ::json_object_set_new(rootJ, "instrumentation", this->instrumentation.toJson());
+#endif
+
     return rootJ;
 }
 
 void ::StoneyDSP::StoneyVCV::LFO::LFOModule::dataFromJson(::json_t *rootJ)
 {
-    ::StoneyDSP::ignoreUnused(rootJ);
+    ::json_t *controlRateDivisionJ = ::json_object_get(rootJ, "controlRateDivision");
+    if (controlRateDivisionJ)
+        this->setControlRateDivision(static_cast<::StoneyDSP::uint32_t>(::json_integer_value(controlRateDivisionJ)));
+
+    ::json_t *doublePrecisionPhaseJ = ::json_object_get(rootJ, "doublePrecisionPhase");
+    if (doublePrecisionPhaseJ)
+        this->setDoublePrecisionPhase(::json_boolean_value(doublePrecisionPhaseJ));
+
+    ::json_t *voiceLightsJ = ::json_object_get(rootJ, "voiceLights");
+    if (voiceLightsJ)
+        this->setVoiceLights(::json_boolean_value(voiceLightsJ));
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::setControlRateDivision(::StoneyDSP::uint32_t newDivision) noexcept
+{
+    this->controlDivider.setDivision(::std::max<::StoneyDSP::uint32_t>(1U, newDivision));
+    this->controlDivider.reset();
+    this->coefficients.update(this->coefficients.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+}
+
+::StoneyDSP::uint32_t StoneyDSP::StoneyVCV::LFO::LFOModule::getControlRateDivision() noexcept
+{
+    return this->controlDivider.getDivision();
 }
 
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::setDoublePrecisionPhase(bool newDoublePrecisionPhase) noexcept
+{
+    this->bank.setDoublePrecisionPhase(newDoublePrecisionPhase);
+}
+
+bool StoneyDSP::StoneyVCV::LFO::LFOModule::getDoublePrecisionPhase() noexcept
+{
+    return this->bank.getDoublePrecisionPhase();
+}
+
+void ::StoneyDSP::StoneyVCV::LFO::LFOModule::setVoiceLights(bool newVoiceLights) noexcept
+{
+    this->voiceLights.store(newVoiceLights, ::std::memory_order_relaxed);
+    this->voiceLightsResetRequested.store(true, ::std::memory_order_relaxed);
+}
+
+bool StoneyDSP::StoneyVCV::LFO::LFOModule::getVoiceLights() noexcept
+{
+    return this->voiceLights.load(::std::memory_order_relaxed);
+}
+
+#if STONEYVCV_INSTRUMENTATION
+::StoneyDSP::StoneyVCV::Instrumentation &::StoneyDSP::StoneyVCV::LFO::LFOModule::getInstrumentation() noexcept
+{
+    return this->instrumentation;
+}
+#endif
+
 //==============================================================================
 
 ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::LFOPanelWidget(::rack::math::Rect newBox)
@@ -376,6 +904,7 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::draw(const ::StoneyDSP::Stoney
     portOutputSqr(nullptr),
     // Lights
     lightLfo(nullptr),
+    voiceLights(),
     // State
     lastPrefersDarkPanels(::rack::settings::preferDarkPanels),
     prefersDarkPanelsPtr(nullptr),
@@ -534,6 +1063,21 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::draw(const ::StoneyDSP::Stoney
             ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxOutputs::SQR_OUTPUT
         )
     );
+    // Lights
+    for (::std::size_t voice = 0U; voice < 16U; ++voice) {
+        this->voiceLights[voice] = dynamic_cast<::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight> *>(
+            ::rack::createLightCentered<::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight>>(
+                ::rack::math::Vec(
+                    (::StoneyDSP::StoneyVCV::LFO::LFODimensions.x * 0.5F) + ((::StoneyDSP::StoneyVCV::Panels::MIN_WIDTH * 0.5F) * (static_cast<float>(voice % 8U) - 3.5F)),
+                    0.0F + ((::StoneyDSP::StoneyVCV::Panels::MIN_WIDTH * 0.5F) * (27.0F + static_cast<float>(voice / 8U)))
+                ),
+                module,
+                ::StoneyDSP::StoneyVCV::LFO::LFOModule::IdxLights::VOICE_LIGHTS + static_cast<int>(voice)
+            )
+        );
+        // Hidden until enabled from the context menu
+        this->voiceLights[voice]->hide();
+    }
 
     this->panelWidget->getPortPanelWidget(0).setPosition(
         ::rack::math::Vec(
@@ -657,6 +1201,8 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::draw(const ::StoneyDSP::Stoney
     this->addOutput(this->portOutputSqr);
     // Lights
     // this->addChild(this->lightLfo);
+    for (auto *voiceLight : this->voiceLights)
+        this->addChild(voiceLight);
 
     // Oversample
     if (static_cast<unsigned int>(APP->window->pixelRatio) < static_cast<unsigned int>(2.0F)) {
@@ -683,6 +1229,8 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::draw(const ::StoneyDSP::Stoney
     assert(this->portOutputTri != nullptr);
     assert(this->portOutputSaw != nullptr);
     assert(this->portOutputSqr != nullptr);
+    for (auto *voiceLight : this->voiceLights)
+        assert(voiceLight != nullptr);
     assert(this->prefersDarkPanelsPtr != nullptr);
     assert(this->pixelRatioPtr != nullptr);
 
@@ -719,6 +1267,8 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOPanelWidget::draw(const ::StoneyDSP::Stoney
     this->portOutputTri = nullptr;
     this->portOutputSaw = nullptr;
     this->portOutputSqr = nullptr;
+    for (auto *&voiceLight : this->voiceLights)
+        voiceLight = nullptr;
     this->prefersDarkPanelsPtr = nullptr;
     this->pixelRatioPtr = nullptr;
 }
@@ -746,9 +1296,40 @@ void ::StoneyDSP::StoneyVCV::LFO::LFOModuleWidget::step()
         this->lastPixelRatio = currentPixelRatio;
     }
 
+    // The per-voice lights are opt-in, per module
+    auto *module = dynamic_cast<::StoneyDSP::StoneyVCV::LFO::LFOModule *>(this->getModule());
+    const bool voiceLightsVisible = (module != nullptr) && module->getVoiceLights();
+    for (auto *voiceLight : this->voiceLights)
+        voiceLight->setVisible(voiceLightsVisible);
+
     return ::rack::Widget::step();
 }
 
+void ::StoneyDSP::StoneyVCV::LFO::LFOModuleWidget::appendContextMenu(::rack::ui::Menu *menu)
+{
+    ::StoneyDSP::StoneyVCV::LFO::LFOModule *module = dynamic_cast<::StoneyDSP::StoneyVCV::LFO::LFOModule *>(this->getModule());
+    assert(module != nullptr);
+
+    menu->addChild(new ::rack::ui::MenuSeparator);
+    menu->addChild(::StoneyDSP::StoneyVCV::createControlRateMenuItem(
+        [=]() { return module->getControlRateDivision(); },
+        [=](::StoneyDSP::uint32_t division) { module->setControlRateDivision(division); }
+    ));
+    menu->addChild(::rack::createBoolMenuItem(
+        "Double-precision phase", "",
+        [=]() { return module->getDoublePrecisionPhase(); },
+        [=](bool doublePrecisionPhase) { module->setDoublePrecisionPhase(doublePrecisionPhase); }
+    ));
+    menu->addChild(::rack::createBoolMenuItem(
+        "Voice lights", "",
+        [=]() { return module->getVoiceLights(); },
+        [=](bool newVoiceLights) { module->setVoiceLights(newVoiceLights); }
+    ));
+#if STONEYVCV_INSTRUMENTATION
+    menu->addChild(::StoneyDSP::StoneyVCV::createInstrumentationMenuItem(&module->getInstrumentation()));
+#endif
+}
+
 void ::StoneyDSP::StoneyVCV::LFO::LFOModuleWidget::onPrefersDarkPanelsChange(const PrefersDarkPanelsChangeEvent & e)
 {
     // Validate
@@ -19,6 +19,7 @@
 #include <StoneyVCV/ComponentLibrary/ParamWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/PanelWidget.hpp>
 #include <StoneyVCV/ComponentLibrary/RoundKnobWidget.hpp>
+#include <StoneyVCV/Kernels.hpp>
 
 //==============================================================================
 
@@ -54,6 +55,20 @@ static const ::rack::math::Vec VCADimensions = ::rack::math::Vec(
 
 //==============================================================================
 
+#if STONEYVCV_INSTRUMENTATION
+static const char *const pathNames[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::NUM_PATHS] = {
+    "Idle",
+    "Output only",
+    "Input without CV",
+    "Input with CV",
+    "Control-rate update",
+    "Lights",
+    "Voice lights"
+};
+#endif
+
+//==============================================================================
+
 } // namespace VCA
 } // namespace StoneyVCV
 } // namespace StoneyDSP
@@ -62,9 +77,8 @@ static const ::rack::math::Vec VCADimensions = ::rack::math::Vec(
 
 template <typename T>
 ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::VCAEngine()
-:   ::StoneyDSP::StoneyVCV::Engine<T>(),
-    gain(static_cast<T>(0.0)),
-    lastGain(static_cast<T>(0.0))
+:   ::StoneyDSP::StoneyVCV::Engine<T, ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>>(),
+    gain()
 {
     // Assertions
     DBG("Constructing StoneyVCV::VCA::VCAEngine");
@@ -76,55 +90,261 @@ template <typename T>
     // Assertions
     DBG("Destroying StoneyVCV::VCA::VCAEngine");
 
-    this->gain = static_cast<T>(0.0);
-    this->lastGain = static_cast<T>(0.0);
+    this->gain.reset(static_cast<T>(0.0));
 }
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSample(T* sample)
 {
-    *sample *= this->gain;
+    *sample = this->gain.processSample(*sample);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSamples(const T *input, T *output, ::std::size_t numSamples)
+{
+    this->gain.process(input, output, numSamples);
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSamples(const T *input, T *output, ::std::size_t numSamples, const T &targetGain)
+{
+    this->gain.process(input, output, numSamples, ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::applyResponse(targetGain, this->response));
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSamples(T *buffer, ::std::size_t numSamples)
+{
+    this->gain.process(buffer, numSamples);
 }
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSampleSimd(::StoneyDSP::SIMD::float_4 *v)
 {
     ::StoneyDSP::SIMD::float_4& input = *v;
-    input *= this->gain;
+    input *= this->gain.getGain();
+    // Applied at once, as by `processSample()`, so the next block ramps from it
+    this->gain.reset(this->gain.getGain());
 }
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSampleSimd(::StoneyDSP::SIMD::double_2 *v)
 {
     ::StoneyDSP::SIMD::double_2& input = *v;
-    input *= this->gain;
+    input *= this->gain.getGain();
+    // Applied at once, as by `processSample()`, so the next block ramps from it
+    this->gain.reset(this->gain.getGain());
+}
+
+#if STONEYDSP_USING_AVX
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSampleSimd(::StoneyDSP::SIMD::float_8 *v)
+{
+    ::StoneyDSP::SIMD::float_8& input = *v;
+    input *= this->gain.getGain();
+    // Applied at once, as by `processSample()`, so the next block ramps from it
+    this->gain.reset(this->gain.getGain());
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::processSampleSimd(::StoneyDSP::SIMD::double_4 *v)
+{
+    ::StoneyDSP::SIMD::double_4& input = *v;
+    input *= this->gain.getGain();
+    // Applied at once, as by `processSample()`, so the next block ramps from it
+    this->gain.reset(this->gain.getGain());
 }
+#endif
 
 template <typename T>
 void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::setGain(const T &newGain)
 {
-    this->gain = newGain;
+    this->gain.setGain(::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::applyResponse(newGain, this->response));
 }
 
 template <typename T>
-T& ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::getGain() noexcept
+const T& ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::getGain() const noexcept
 {
-    return this->gain;
+    return this->gain.getGain();
+}
+
+template <typename T>
+const T& ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::getLastGain() const noexcept
+{
+    return this->gain.getLastGain();
+}
+
+template <typename T>
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept
+{
+    this->response = newResponse;
+}
+
+template <typename T>
+::StoneyDSP::StoneyVCV::VCA::Response StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::getResponse() const noexcept
+{
+    return this->response;
+}
+
+template <typename T>
+T StoneyDSP::StoneyVCV::VCA::VCAEngine<T>::applyResponse(const T &level, ::StoneyDSP::StoneyVCV::VCA::Response response) noexcept
+{
+    const T zero = static_cast<T>(0.0F);
+    const T one = static_cast<T>(1.0F);
+
+    switch (response) {
+    case ::StoneyDSP::StoneyVCV::VCA::Response::Exponential: {
+        // 10 octaves of gain, i.e. 60dB, linear in decibels
+        const T x = ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(level, zero), one);
+        return (::StoneyDSP::SIMD::exp2(x * static_cast<T>(10.0F)) - one) / static_cast<T>(1023.0F);
+    }
+    case ::StoneyDSP::StoneyVCV::VCA::Response::Logarithmic: {
+        const T x = ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(level, zero), one);
+        const T y = ::StoneyDSP::SIMD::log2(x * static_cast<T>(1023.0F) + one) * static_cast<T>(0.1F);
+        // `log2(1)` is only approximately `0`
+        return ::StoneyDSP::SIMD::fmin(::StoneyDSP::SIMD::fmax(y, zero), one);
+    }
+    case ::StoneyDSP::StoneyVCV::VCA::Response::Linear:
+    default:
+        return level;
+    }
 }
 
 template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<double>;
 template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>;
+template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::double_2>;
+template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::float_4>;
+#if STONEYDSP_USING_AVX
+template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::double_4>;
+template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::float_8>;
+#endif
+
+//==============================================================================
 
-// template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::rack::simd::float_4>;
-// template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::double_2>;
+::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::VCAEngineBank()
+:   gain(),
+    target(),
+    end(),
+    step(),
+    remaining(0U),
+    rampLength(1U),
+    rampReciprocal(1.0F),
+    response(::StoneyDSP::StoneyVCV::VCA::Response::Linear),
+    gainKernel(::StoneyDSP::StoneyVCV::Kernels::get().vcaGain)
+{
+    DBG("Constructing StoneyVCV::VCA::VCAEngineBank");
+}
+
+::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::~VCAEngineBank() noexcept
+{
+    DBG("Destroying StoneyVCV::VCA::VCAEngineBank");
+
+    this->reset(0.0F);
+}
+
+STONEYVCV_ALWAYS_INLINE void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::process(const float *input, float *output, ::std::size_t numChannels) noexcept
+{
+    static constexpr ::std::size_t size = ::StoneyDSP::SIMD::PolyBuffer<float>::size();
+
+    // Start the next ramp, from wherever the last one ended to whatever has
+    // been staged since
+    if (this->remaining == 0U) {
+        const vector_type reciprocal(this->rampReciprocal);
+        for (::std::size_t channel = 0U; channel < size; channel += vector_type::size) {
+            this->step.store(channel, (this->target.load<vector_type>(channel) - this->gain.load<vector_type>(channel)) * reciprocal);
+        }
+        this->end = this->target;
+        this->remaining = this->rampLength;
+    }
+
+    // Every channel is ramped, active or not, so that none is left behind
+    // when the channel count grows
+    if (--this->remaining == 0U) {
+        // The ramp ends exactly on its target, however the steps rounded
+        this->gain = this->end;
+        this->step.fill(0.0F);
+    }
+
+    if (this->gainKernel != nullptr) {
+        this->gainKernel(input, output, this->gain.data(), this->step.data(), numChannels);
+        return;
+    }
+
+    for (::std::size_t channel = 0U; channel < size; channel += vector_type::size) {
+        this->gain.store(channel, this->gain.load<vector_type>(channel) + this->step.load<vector_type>(channel));
+    }
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += vector_type::size) {
+        (vector_type::load(input + channel) * this->gain.load<vector_type>(channel)).store(output + channel);
+    }
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::setGain(float newGain) noexcept
+{
+    this->target.fill(::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>::applyResponse(newGain, this->response));
+}
+
+STONEYVCV_ALWAYS_INLINE void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::setGain(::std::size_t channel, const vector_type &newGain) noexcept
+{
+    this->target.store(channel, ::StoneyDSP::StoneyVCV::VCA::VCAEngine<vector_type>::applyResponse(newGain, this->response));
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::reset(float newGain) noexcept
+{
+    this->setGain(newGain);
+    this->gain = this->target;
+    this->end = this->target;
+    this->step.fill(0.0F);
+    this->remaining = 0U;
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::setRampLength(::std::size_t numSamples) noexcept
+{
+    this->rampLength = ::std::max<::std::size_t>(1U, numSamples);
+    this->rampReciprocal = 1.0F / static_cast<float>(this->rampLength);
+}
+
+::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::vector_type StoneyDSP::StoneyVCV::VCA::VCAEngineBank::getGain(::std::size_t channel) const noexcept
+{
+    return this->gain.load<vector_type>(channel);
+}
+
+const ::StoneyDSP::SIMD::PolyBuffer<float>& StoneyDSP::StoneyVCV::VCA::VCAEngineBank::getGains() const noexcept
+{
+    return this->gain;
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept
+{
+    this->response = newResponse;
+}
+
+::StoneyDSP::StoneyVCV::VCA::Response StoneyDSP::StoneyVCV::VCA::VCAEngineBank::getResponse() const noexcept
+{
+    return this->response;
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAEngineBank::setKernels(const ::StoneyDSP::StoneyVCV::Kernels::Table &kernels) noexcept
+{
+    this->gainKernel = kernels.vcaGain;
+}
 
 //==============================================================================
 
 ::StoneyDSP::StoneyVCV::VCA::VCAModule::VCAModule()
 :   ::rack::engine::Module::Module(),
     lightDivider(),
-    engine(),
-    lightGains{0.0F},
+    controlDivider(),
+    coefficients(),
+    gainCoefficient(0.0F),
+    connections(0U),
+    bank(),
+    meter(),
+    voiceMeter(),
+    voiceLights(false),
+    voiceLightsResetRequested(false),
+#if STONEYVCV_INSTRUMENTATION
+    instrumentation(::StoneyDSP::StoneyVCV::VCA::pathNames, ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::NUM_PATHS),
+#endif
     vcaInputPtr(nullptr),
     cvInputPtr(nullptr),
     gainParamPtr(nullptr),
@@ -136,7 +356,7 @@ template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>;
     assert(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxParams::NUM_PARAMS == 1U);
     assert(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::NUM_INPUTS == 2U);
     assert(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxOutputs::NUM_OUTPUTS == 1U);
-    assert(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::NUM_LIGHTS == 2U);
+    assert(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::NUM_LIGHTS == 18U);
 
     // Configure the number of Params, Outputs, Inputs, and Lights.
     this->config(
@@ -172,9 +392,9 @@ template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>;
         ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxOutputs::VCA_OUTPUT
     );
     this->lightDivider.setDivision(16);
-    for(auto &e : this->engine) {
-        e.setGain(0.0F);
-    }
+    this->controlDivider.setDivision(::StoneyDSP::StoneyVCV::Tools::controlRateDivision);
+    this->coefficients.update(this->coefficients.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+    this->bank.setRampLength(this->controlDivider.getDivision());
 
     this->vcaInputPtr = dynamic_cast<::rack::engine::Input*>(&this->inputs[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::VCA_INPUT]);
     this->cvInputPtr = dynamic_cast<::rack::engine::Input*>(&this->inputs[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::CV_INPUT]);
@@ -187,19 +407,16 @@ template struct ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>;
     assert(this->gainParamPtr != nullptr);
     assert(this->vcaOutputPtr != nullptr);
     assert(this->blinkLightPtr != nullptr);
+
+    // Start at the knob, rather than fading in from silence
+    this->resetGainCoefficient();
 }
 
 ::StoneyDSP::StoneyVCV::VCA::VCAModule::~VCAModule() noexcept
 {
     DBG("Destroying StoneyVCV::VCA::VCAModule");
 
-    for(auto &e : this->engine) {
-        e.setGain(0.0F);
-    }
-
-    for(auto &lightGain : this->lightGains) {
-        lightGain = (0.0F);
-    }
+    this->bank.reset(0.0F);
 
     this->vcaInputPtr = nullptr;
     this->cvInputPtr = nullptr;
@@ -214,72 +431,194 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAModule::process(const ::StoneyDSP::StoneyVC
     auto &cv_input = *this->cvInputPtr;
     auto &gain_param = *this->gainParamPtr;
     auto &vca_output = *this->vcaOutputPtr;
-    // auto &blink_light = *this->blinkLightPtr;
-    auto &blink_light = this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::BLINK_LIGHT + 0];
-    auto &blink_light_r = this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::BLINK_LIGHT + 1];
 
-    // if (!vca_input.isConnected() && !vca_output.isConnected() && !cv_input.isConnected()) {
-    //     return;
-    // }
+    static constexpr ::StoneyDSP::uint32_t vcaInputConnected = 1U << ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::VCA_INPUT;
+    static constexpr ::StoneyDSP::uint32_t cvInputConnected = 1U << ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::CV_INPUT;
+
+    STONEYVCV_INSTRUMENT(this->instrumentation.begin());
+
+    // Fully idle; nothing is patched, so there is nothing to process, but
+    // the light still follows the knob and the voice lights fade out
+    if (this->connections == 0U) {
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::IDLE_PATH));
+        if (this->lightDivider.process()) {
+            // Kept in sync, so that patching a cable doesn't fade in from the
+            // knob's position before the module went idle
+            this->resetGainCoefficient();
+            this->meter.process(this->bank.getGain(0U), 0U, 1U);
+            this->processLights(0U);
+        }
+        STONEYVCV_INSTRUMENT(this->instrumentation.end(0U));
+        return;
+    }
 
-    // Panel-based params are monophonic by nature,
-    // so don't iterate over them
-    const auto &gain = gain_param.getValue();
+    // Panel-based params are monophonic by nature, so don't iterate over
+    // them; nor do they change at audio rate, so only read them, and the CV,
+    // at the control rate, and let the bank ramp towards the new gain over
+    // one division
+    const bool controlRate = this->controlDivider.process();
+    if (controlRate) {
+        this->gainCoefficient = gain_param.getValue() * 0.01F;
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::CONTROL_RATE_PATH));
+    }
 
     // Get desired number of channels from a "primary" input.
 	// If this input is unpatched, getChannels() returns 0, but we should
     // still generate 1 channel of output.
     // (allocation)
-    ::std::size_t numChannels = ::std::max<::std::size_t>({
-        1U,
-        static_cast<unsigned int>(vca_input.getChannels()),
-        static_cast<unsigned int>(cv_input.getChannels())
-    });
+    ::std::size_t numChannels = 1U;
+
+    if ((this->connections & (vcaInputConnected | cvInputConnected)) == 0U) {
+
+        // Output only; the input is normalled to 0v, so the output is a
+        // constant 0v regardless of the gain, which needn't be ramped
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::OUTPUT_ONLY_PATH));
+        vca_output.setVoltage(vFloor);
+        if (controlRate) {
+            // The gain when the CV input is unpatched, i.e. normalled to 10v
+            this->bank.reset(vNominal * this->gainCoefficient);
+        }
+        this->meter.process(this->bank.getGain(0U), 0U, 1U);
+    }
+    else if ((this->connections & cvInputConnected) == 0U) {
+
+        // Input without CV; every channel shares the knob's gain
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::NO_CV_PATH));
+        numChannels = ::std::max<::std::size_t>(1U, static_cast<unsigned int>(vca_input.getChannels()));
+        this->processChannels(numChannels, controlRate);
+    }
+    else {
+
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::CV_PATH));
+        numChannels = ::std::max<::std::size_t>({
+            1U,
+            static_cast<unsigned int>(vca_input.getChannels()),
+            static_cast<unsigned int>(cv_input.getChannels())
+        });
+        this->processChannels(numChannels, controlRate);
+    }
+
+	vca_output.setChannels(numChannels);
 
-    // Poly process block
-    for (::std::size_t channel = 0U; channel < numChannels; channel++ /** channel += 4 */ ) {
+    // Lights
+    if (this->lightDivider.process()) {
+        this->processLights(numChannels);
+    }
 
-        // const auto& cchannel = channel / 4;
+    STONEYVCV_INSTRUMENT(this->instrumentation.end(numChannels));
+}
 
-        // Get input or 0v (allocation)
-        auto input = vca_input.getNormalPolyVoltage(vFloor, channel);
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::processChannels(::std::size_t numChannels, bool controlRate)
+{
+    auto &vca_input = *this->vcaInputPtr;
+    auto &cv_input = *this->cvInputPtr;
+    auto &vca_output = *this->vcaOutputPtr;
 
-        // Get cv or 10v as 0..1
-        const auto &cv = ::rack::clamp(cv_input.getNormalPolyVoltage(vNominal, channel) * gain * 0.01F, vFloor, vNominal);
+    static constexpr ::StoneyDSP::uint32_t cvInputConnected = 1U << ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::CV_INPUT;
 
-        // Apply gain
-        this->engine[channel].setGain(cv);
+    const auto &gain = this->gainCoefficient;
 
-        // Process input
-        this->engine[channel].processSample(&input);
+    if ((this->connections & cvInputConnected) == 0U) {
 
-        // Set output
-        vca_output.setVoltage(input, channel);
+        // The gain when the CV input is unpatched, i.e. normalled to 10v
+        if (controlRate) {
+            this->bank.setGain(vNominal * gain);
+        }
 
-        // Set lights
-        this->lightGains[channel] = this->engine[channel].getGain();
+        this->bank.process(vca_input.getVoltages(), vca_output.getVoltages(), numChannels);
+        this->meter.process(this->bank.getGain(0U), 0U, numChannels);
+        return;
     }
 
-	vca_output.setChannels(numChannels);
+    ::StoneyDSP::SIMD::PolyBuffer<float> input;
 
-    // Lights
-    if (this->lightDivider.process()) {
-        auto lightValue = *::std::max_element<float *>(this->lightGains.begin(), this->lightGains.end());
-        blink_light.setBrightnessSmooth(
-            1.0F - lightValue, //(lightValue * lightValue),
-            this->lightDivider.getDivision() * args.sampleTime
-        );
-        blink_light_r.setBrightnessSmooth(
-            lightValue, //(lightValue * lightValue),
-            this->lightDivider.getDivision() * args.sampleTime
+    for (::std::size_t channel = 0U; channel < numChannels; channel += vector_type::size) {
+
+        // Get input or 0v; normalled, so a mono input is spread across every
+        // channel
+        input.store(channel, vca_input.getNormalPolyVoltageSimd<vector_type>(vFloor, channel));
+
+        if (controlRate) {
+
+            // Get cv or 10v as 0..1; a cv above 10v may boost, through the
+            // `Linear` response, but a negative one never inverts
+            const vector_type cv = ::StoneyDSP::SIMD::fmax(
+                cv_input.getNormalPolyVoltageSimd<vector_type>(vNominal, channel) * gain,
+                vector_type(0.0F)
+            );
+
+            // Stage gain
+            this->bank.setGain(channel, cv);
+        }
+    }
+
+    // Apply gain, and set output
+    this->bank.process(input.data(), vca_output.getVoltages(), numChannels);
+
+    for (::std::size_t channel = 0U; channel < numChannels; channel += vector_type::size) {
+        this->meter.process(this->bank.getGain(channel), channel, numChannels);
+    }
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::resetGainCoefficient() noexcept
+{
+    this->gainCoefficient = this->gainParamPtr->getValue() * 0.01F;
+    this->bank.reset(vNominal * this->gainCoefficient);
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::processLights(::std::size_t numChannels)
+{
+    // auto &blink_light = *this->blinkLightPtr;
+    auto &blink_light = this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::BLINK_LIGHT + 0];
+    auto &blink_light_r = this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::BLINK_LIGHT + 1];
+
+    STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::LIGHTS_PATH));
+    // The peak gain of the active channels over the last block
+    const float lightValue = this->meter.flush();
+    blink_light.setBrightnessSmooth(
+        1.0F - lightValue, //(lightValue * lightValue),
+        this->coefficients.lightDeltaTime
+    );
+    blink_light_r.setBrightnessSmooth(
+        lightValue, //(lightValue * lightValue),
+        this->coefficients.lightDeltaTime
+    );
+    // blink_light.setBrightnessSmooth(
+    //     (lightValue * lightValue),
+    //     this->coefficients.lightDeltaTime
+    // );
+    if (this->voiceLightsResetRequested.load(::std::memory_order_relaxed)) {
+        this->voiceMeter.reset(&this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::VOICE_LIGHTS]);
+        this->voiceLightsResetRequested.store(false, ::std::memory_order_relaxed);
+    }
+    if (this->voiceLights.load(::std::memory_order_relaxed)) {
+        STONEYVCV_INSTRUMENT(this->instrumentation.path(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxPaths::VOICE_LIGHTS_PATH));
+        this->voiceMeter.process(
+            this->bank.getGains(),
+            numChannels,
+            this->coefficients.lightDeltaTime,
+            &this->lights[::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::VOICE_LIGHTS]
         );
-        // blink_light.setBrightnessSmooth(
-        //     (lightValue * lightValue),
-        //     this->lightDivider.getDivision() * args.sampleTime
-        // );
     }
 }
 
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::onPortChange(const ::rack::engine::Module::PortChangeEvent &e)
+{
+    const auto bit = (e.type == ::rack::engine::Port::INPUT)
+        ? static_cast<::StoneyDSP::uint32_t>(e.portId)
+        : static_cast<::StoneyDSP::uint32_t>(::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxInputs::NUM_INPUTS + e.portId);
+
+    if (e.connecting)
+        this->connections |= (1U << bit);
+    else
+        this->connections &= ~(1U << bit);
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::onSampleRateChange(const ::rack::engine::Module::SampleRateChangeEvent &e)
+{
+    this->coefficients.update(e.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+}
+
 ::std::size_t StoneyDSP::StoneyVCV::VCA::VCAModule::getVcaInputNumChannels() noexcept
 {
     return static_cast<unsigned>(this->vcaInputPtr->getChannels());
@@ -326,20 +665,87 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAModule::process(const ::StoneyDSP::StoneyVC
     return *this->blinkLightPtr;
 }
 
-// ::json_t *::StoneyDSP::StoneyVCV::VCA::VCAModule::dataToJson()
-// {
-//     ::json_t *rootJ = ::json_object();
-//     ::json_object_set_new(rootJ, "gain", ::json_real(gain));
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::setControlRateDivision(::StoneyDSP::uint32_t newDivision) noexcept
+{
+    this->controlDivider.setDivision(::std::max<::StoneyDSP::uint32_t>(1U, newDivision));
+    this->controlDivider.reset();
+    this->coefficients.update(this->coefficients.sampleRate, this->lightDivider.getDivision(), this->controlDivider.getDivision());
+    this->bank.setRampLength(this->controlDivider.getDivision());
+}
+
+::StoneyDSP::uint32_t StoneyDSP::StoneyVCV::VCA::VCAModule::getControlRateDivision() noexcept
+{
+    return this->controlDivider.getDivision();
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::setResponse(::StoneyDSP::StoneyVCV::VCA::Response newResponse) noexcept
+{
+    this->bank.setResponse(newResponse);
+}
 
-//     return rootJ;
-// }
+::StoneyDSP::StoneyVCV::VCA::Response StoneyDSP::StoneyVCV::VCA::VCAModule::getResponse() noexcept
+{
+    return this->bank.getResponse();
+}
 
-// void ::StoneyDSP::StoneyVCV::VCA::VCAModule::dataFromJson(::json_t *rootJ)
-// {
-//     ::json_t *gainJ = ::json_object_get(rootJ, "gain");
-//     if (gainJ)
-//         gain = json_number_value(gainJ);
-// }
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::setVoiceLights(bool newVoiceLights) noexcept
+{
+    this->voiceLights.store(newVoiceLights, ::std::memory_order_relaxed);
+    this->voiceLightsResetRequested.store(true, ::std::memory_order_relaxed);
+}
+
+bool StoneyDSP::StoneyVCV::VCA::VCAModule::getVoiceLights() noexcept
+{
+    return this->voiceLights.load(::std::memory_order_relaxed);
+}
+
+#if STONEYVCV_INSTRUMENTATION
+::StoneyDSP::StoneyVCV::Instrumentation &::StoneyDSP::StoneyVCV::VCA::VCAModule::getInstrumentation() noexcept
+{
+    return this->instrumentation;
+}
+#endif
+
+::json_t *::StoneyDSP::StoneyVCV::VCA::VCAModule::dataToJson()
+{
+    ::json_t *rootJ = ::json_object();
+    ::json_object_set_new(rootJ, "controlRateDivision", ::json_integer(this->getControlRateDivision()));
+    ::json_object_set_new(rootJ, "response", ::json_integer(static_cast<::json_int_t>(this->getResponse())));
+    ::json_object_set_new(rootJ, "voiceLights", ::json_boolean(this->getVoiceLights()));
+#if STONEYVCV_INSTRUMENTATION
+    // Written for inspection only; never read back
+    ::json_object_set_new(rootJ, "instrumentation", this->instrumentation.toJson());
+#endif
+
+    return rootJ;
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::dataFromJson(::json_t *rootJ)
+{
+    ::json_t *controlRateDivisionJ = ::json_object_get(rootJ, "controlRateDivision");
+    if (controlRateDivisionJ)
+        this->setControlRateDivision(static_cast<::StoneyDSP::uint32_t>(::json_integer_value(controlRateDivisionJ)));
+
+    ::json_t *responseJ = ::json_object_get(rootJ, "response");
+    if (responseJ) {
+        const auto response = ::json_integer_value(responseJ);
+        if (response >= 0 && response <= static_cast<::json_int_t>(::StoneyDSP::StoneyVCV::VCA::Response::Logarithmic))
+            this->setResponse(static_cast<::StoneyDSP::StoneyVCV::VCA::Response>(response));
+    }
+
+    ::json_t *voiceLightsJ = ::json_object_get(rootJ, "voiceLights");
+    if (voiceLightsJ)
+        this->setVoiceLights(::json_boolean_value(voiceLightsJ));
+
+    // The params are loaded before the data
+    this->resetGainCoefficient();
+}
+
+void ::StoneyDSP::StoneyVCV::VCA::VCAModule::onReset(const ::rack::engine::Module::ResetEvent &e)
+{
+    ::rack::engine::Module::onReset(e);
+    this->resetGainCoefficient();
+}
 
 //==============================================================================
 
@@ -470,6 +876,7 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAPanelWidget::draw(const ::StoneyDSP::Stoney
     //     )
     // ),
     vcaLight(nullptr),
+    voiceLights(),
     lastPrefersDarkPanels(::rack::settings::preferDarkPanels),
     prefersDarkPanelsPtr(nullptr),
     lastPixelRatio(APP->window->pixelRatio),
@@ -557,6 +964,20 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAPanelWidget::draw(const ::StoneyDSP::Stoney
             ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::BLINK_LIGHT
         )
     );
+    for (::std::size_t voice = 0U; voice < 16U; ++voice) {
+        this->voiceLights[voice] = dynamic_cast<::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight> *>(
+            ::rack::createLightCentered<::rack::componentlibrary::TinyLight<::rack::componentlibrary::GreenLight>>(
+                ::rack::math::Vec(
+                    (::StoneyDSP::StoneyVCV::VCA::VCADimensions.x * 0.5F) + ((::StoneyDSP::StoneyVCV::Panels::MIN_WIDTH * 0.5F) * (static_cast<float>(voice % 8U) - 3.5F)),
+                    0.0F + ((::StoneyDSP::StoneyVCV::Panels::MIN_WIDTH * 0.5F) * (23.0F + static_cast<float>(voice / 8U)))
+                ),
+                module,
+                ::StoneyDSP::StoneyVCV::VCA::VCAModule::IdxLights::VOICE_LIGHTS + static_cast<int>(voice)
+            )
+        );
+        // Hidden until enabled from the context menu
+        this->voiceLights[voice]->hide();
+    }
 
     this->panelWidget->getPortPanelWidget(0).setPosition(
         ::rack::math::Vec(
@@ -615,6 +1036,8 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAPanelWidget::draw(const ::StoneyDSP::Stoney
     this->addOutput(this->portOutputVca);
     // Lights
     this->addChild(this->vcaLight);
+    for (auto *voiceLight : this->voiceLights)
+        this->addChild(voiceLight);
 
     // Oversample
     if (static_cast<unsigned int>(APP->window->pixelRatio) < static_cast<unsigned int>(2.0F)) {
@@ -635,6 +1058,8 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAPanelWidget::draw(const ::StoneyDSP::Stoney
     assert(this->portInputVca != nullptr);
     assert(this->portOutputVca != nullptr);
     assert(this->vcaLight != nullptr);
+    for (auto *voiceLight : this->voiceLights)
+        assert(voiceLight != nullptr);
     assert(this->prefersDarkPanelsPtr != nullptr);
     assert(this->pixelRatioPtr != nullptr);
 
@@ -663,6 +1088,8 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAPanelWidget::draw(const ::StoneyDSP::Stoney
     this->portInputVca = nullptr;
     this->portOutputVca = nullptr;
     this->vcaLight = nullptr;
+    for (auto *&voiceLight : this->voiceLights)
+        voiceLight = nullptr;
     this->prefersDarkPanelsPtr = nullptr;
     this->pixelRatioPtr = nullptr;
 }
@@ -690,6 +1117,12 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAModuleWidget::step()
         this->lastPixelRatio = currentPixelRatio;
     }
 
+    // The per-voice lights are opt-in, per module
+    auto *module = dynamic_cast<::StoneyDSP::StoneyVCV::VCA::VCAModule *>(this->getModule());
+    const bool voiceLightsVisible = (module != nullptr) && module->getVoiceLights();
+    for (auto *voiceLight : this->voiceLights)
+        voiceLight->setVisible(voiceLightsVisible);
+
     return ::rack::app::ModuleWidget::step();
 }
 
@@ -698,6 +1131,32 @@ void ::StoneyDSP::StoneyVCV::VCA::VCAModuleWidget::draw(const ::StoneyDSP::Stone
     return ::rack::app::ModuleWidget::draw(args);
 }
 
+void ::StoneyDSP::StoneyVCV::VCA::VCAModuleWidget::appendContextMenu(::rack::ui::Menu *menu)
+{
+    ::StoneyDSP::StoneyVCV::VCA::VCAModule *module = dynamic_cast<::StoneyDSP::StoneyVCV::VCA::VCAModule *>(this->getModule());
+    assert(module != nullptr);
+
+    menu->addChild(new ::rack::ui::MenuSeparator);
+    menu->addChild(::StoneyDSP::StoneyVCV::createControlRateMenuItem(
+        [=]() { return module->getControlRateDivision(); },
+        [=](::StoneyDSP::uint32_t division) { module->setControlRateDivision(division); }
+    ));
+    menu->addChild(::rack::createIndexSubmenuItem(
+        "Response",
+        {"Linear", "Exponential", "Logarithmic"},
+        [=]() -> ::std::size_t { return static_cast<::std::size_t>(module->getResponse()); },
+        [=](::std::size_t index) { module->setResponse(static_cast<::StoneyDSP::StoneyVCV::VCA::Response>(index)); }
+    ));
+    menu->addChild(::rack::createBoolMenuItem(
+        "Voice lights", "",
+        [=]() { return module->getVoiceLights(); },
+        [=](bool newVoiceLights) { module->setVoiceLights(newVoiceLights); }
+    ));
+#if STONEYVCV_INSTRUMENTATION
+    menu->addChild(::StoneyDSP::StoneyVCV::createInstrumentationMenuItem(&module->getInstrumentation()));
+#endif
+}
+
 void ::StoneyDSP::StoneyVCV::VCA::VCAModuleWidget::onPrefersDarkPanelsChange(const PrefersDarkPanelsChangeEvent & e)
 {
     // Validate
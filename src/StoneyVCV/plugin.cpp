@@ -14,6 +14,7 @@
 //==============================================================================
 
 #include <StoneyVCV.hpp>
+#include <StoneyVCV/Kernels.hpp>
 
 //==============================================================================
 
@@ -65,6 +66,10 @@ void init(::rack::plugin::Plugin* p) {
 
     ::StoneyDSP::StoneyVCV::Plugin::pluginInstance = p;
 
+    // Before any module, and so any engine, is created
+    const auto &kernels = ::StoneyDSP::StoneyVCV::Kernels::select();
+    INFO("StoneyVCV: using %s kernels", ::StoneyDSP::StoneyVCV::Kernels::getName(kernels.instructionSet));
+
 #ifdef STONEYVCV_BUILD_VCA
     p->addModel(::StoneyDSP::StoneyVCV::VCA::modelVCA);
 #endif
@@ -41,7 +41,7 @@ public:
     static constexpr ::StoneyDSP::size_t NUM_PARAMS = 4U;
     static constexpr ::StoneyDSP::size_t NUM_INPUTS = 4U;
     static constexpr ::StoneyDSP::size_t NUM_OUTPUTS = 4U;
-    static constexpr ::StoneyDSP::size_t NUM_LIGHTS = 2U;
+    static constexpr ::StoneyDSP::size_t NUM_LIGHTS = 18U;
     const ::rack::math::Vec size;
     LFOSpec()
     :   slug("LFO"),
@@ -98,6 +98,150 @@ TEST_CASE( "LFO", "[LFO]" ) {
 
     //==========================================================================
 
+    SECTION( "doublePrecisionPhase" ) {
+        using LFOModule = ::StoneyDSP::StoneyVCV::LFO::LFOModule;
+
+        // The phase accumulator is only reachable through the module
+        LFOModule test_lfoModule, reference;
+        ::rack::engine::Module::ProcessArgs args;
+        args.sampleRate = 1000.0F;
+        args.sampleTime = 1.0F / 1000.0F;
+        for (LFOModule* module : {&test_lfoModule, &reference}) {
+            module->onSampleRateChange({args.sampleRate, args.sampleTime});
+            module->outputs[LFOModule::SAW_OUTPUT].channels = 1;
+            ::rack::engine::Module::PortChangeEvent e;
+            e.connecting = true;
+            e.type = ::rack::engine::Port::OUTPUT;
+            e.portId = LFOModule::SAW_OUTPUT;
+            module->onPortChange(e);
+        }
+
+        for (int i = 0; i < 100; i++) {
+            test_lfoModule.process(args);
+            reference.process(args);
+        }
+
+        // Each switch continues from where the voices were, rather than from
+        // wherever the other accumulator was left
+        for (bool doublePrecisionPhase : {true, false, true}) {
+            test_lfoModule.setDoublePrecisionPhase(doublePrecisionPhase);
+            REQUIRE( test_lfoModule.getDoublePrecisionPhase() == doublePrecisionPhase );
+            for (int i = 0; i < 10; i++) {
+                test_lfoModule.process(args);
+                reference.process(args);
+            }
+            REQUIRE_THAT(
+                test_lfoModule.outputs[LFOModule::SAW_OUTPUT].getVoltage(),
+                Catch::Matchers::WithinAbs(reference.outputs[LFOModule::SAW_OUTPUT].getVoltage(), 1.0e-4F)
+            );
+        }
+    }
+
+    //==========================================================================
+
+    SECTION( "clock" ) {
+        using LFOModule = ::StoneyDSP::StoneyVCV::LFO::LFOModule;
+
+        // One LFO is clocked, the other is reset by the same pulses; until the
+        // clock has been timed over a whole period, both run at the knob rate
+        LFOModule clocked, reference;
+        ::rack::engine::Module::ProcessArgs args;
+        args.sampleRate = 1000.0F;
+        args.sampleTime = 1.0F / 1000.0F;
+        const int inputIds[2] = {LFOModule::CLK_INPUT, LFOModule::RST_INPUT};
+        LFOModule* modules[2] = {&clocked, &reference};
+        for (int m = 0; m < 2; m++) {
+            modules[m]->onSampleRateChange({args.sampleRate, args.sampleTime});
+            modules[m]->outputs[LFOModule::SAW_OUTPUT].channels = 1;
+            modules[m]->inputs[inputIds[m]].channels = 1;
+            for (auto type : {::rack::engine::Port::INPUT, ::rack::engine::Port::OUTPUT}) {
+                ::rack::engine::Module::PortChangeEvent e;
+                e.connecting = true;
+                e.type = type;
+                e.portId = (type == ::rack::engine::Port::INPUT) ? inputIds[m] : static_cast<int>(LFOModule::SAW_OUTPUT);
+                modules[m]->onPortChange(e);
+            }
+        }
+
+        auto pulse = [&](float voltage, int numSamples) {
+            for (int i = 0; i < numSamples; i++) {
+                for (int m = 0; m < 2; m++) {
+                    modules[m]->inputs[inputIds[m]].setVoltage(voltage);
+                    modules[m]->process(args);
+                }
+            }
+        };
+
+        // Low for a while, then the first edge; the time since the clock was
+        // patched is not a period
+        pulse(0.0F, 250);
+        pulse(10.0F, 1);
+        pulse(0.0F, 50);
+        REQUIRE_THAT(
+            clocked.outputs[LFOModule::SAW_OUTPUT].getVoltage(),
+            Catch::Matchers::WithinAbs(reference.outputs[LFOModule::SAW_OUTPUT].getVoltage(), 1.0e-4F)
+        );
+
+        // The second edge times a whole period, so the rates part
+        pulse(10.0F, 1);
+        pulse(0.0F, 50);
+        REQUIRE_FALSE( ::std::abs(clocked.outputs[LFOModule::SAW_OUTPUT].getVoltage() - reference.outputs[LFOModule::SAW_OUTPUT].getVoltage()) < 1.0e-2F );
+    }
+
+    //==========================================================================
+
+    SECTION( "Kernels" ) {
+        using InstructionSet = ::StoneyDSP::StoneyVCV::Kernels::InstructionSet;
+        using float_4 = ::StoneyDSP::SIMD::float_4;
+        namespace Kernels = ::StoneyDSP::StoneyVCV::Kernels;
+
+        // The baseline leaves the bank to its shared LFOEngine
+        REQUIRE( Kernels::get(InstructionSet::Baseline).lfoWaveforms == nullptr );
+
+        // Every wide kernel the host CPU runs shapes the same waveforms as
+        // the LFOEngine, across the whole period and both PolyBLEP edges
+        const float sampleTime = 1.0F / 48000.0F;
+        ::StoneyDSP::StoneyVCV::LFO::LFOEngine<float_4> shaper;
+        shaper.setSampleTime(float_4(sampleTime));
+
+        for (auto instructionSet : {InstructionSet::AVX, InstructionSet::AVX2}) {
+            if (!Kernels::isSupported(instructionSet))
+                continue;
+            INFO( Kernels::getName(instructionSet) );
+            const auto lfoWaveforms = Kernels::get(instructionSet).lfoWaveforms;
+            REQUIRE( lfoWaveforms != nullptr );
+
+            ::StoneyDSP::SIMD::PolyBuffer<float> phase, frequency, pulseWidth, sin, tri, saw, sqr;
+            for (::std::size_t channel = 0U; channel < 16U; channel++) {
+                frequency[channel] = 100.0F * static_cast<float>(channel + 1U);
+                pulseWidth[channel] = 0.05F + 0.06F * static_cast<float>(channel);
+            }
+
+            for (int i = 0; i < 250; i++) {
+                for (::std::size_t channel = 0U; channel < 16U; channel++) {
+                    const float p = static_cast<float>(i) * 0.004F + static_cast<float>(channel) * 0.061F;
+                    phase[channel] = p - ::std::floor(p);
+                }
+                lfoWaveforms(phase.data(), frequency.data(), pulseWidth.data(), sampleTime, sin.data(), tri.data(), saw.data(), sqr.data(), 16U);
+
+                for (::std::size_t channel = 0U; channel < 16U; channel += float_4::size) {
+                    float_4 sinValue, triValue, sawValue, sqrValue;
+                    shaper.setFrequency(frequency.load<float_4>(channel));
+                    shaper.setPulseWidth(pulseWidth.load<float_4>(channel));
+                    shaper.processSample(phase.load<float_4>(channel), &sinValue, &triValue, &sawValue, &sqrValue);
+                    for (::std::size_t lane = 0U; lane < float_4::size; lane++) {
+                        REQUIRE_THAT( sin[channel + lane], Catch::Matchers::WithinAbs(sinValue[lane], 1.0e-5F) );
+                        REQUIRE_THAT( tri[channel + lane], Catch::Matchers::WithinAbs(triValue[lane], 1.0e-5F) );
+                        REQUIRE_THAT( saw[channel + lane], Catch::Matchers::WithinAbs(sawValue[lane], 1.0e-5F) );
+                        REQUIRE_THAT( sqr[channel + lane], Catch::Matchers::WithinAbs(sqrValue[lane], 1.0e-5F) );
+                    }
+                }
+            }
+        }
+    }
+
+    //==========================================================================
+
     SECTION( "createModelLFO" ) {
 
         ::rack::plugin::Model* test_modelLFO = ::StoneyDSP::StoneyVCV::LFO::createModelLFO();
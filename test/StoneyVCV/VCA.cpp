@@ -37,7 +37,7 @@ public:
     static constexpr ::StoneyDSP::size_t NUM_PARAMS = 1U;
     static constexpr ::StoneyDSP::size_t NUM_INPUTS = 2U;
     static constexpr ::StoneyDSP::size_t NUM_OUTPUTS = 1U;
-    static constexpr ::StoneyDSP::size_t NUM_LIGHTS = 2U;
+    static constexpr ::StoneyDSP::size_t NUM_LIGHTS = 18U;
     const ::rack::math::Vec size;
     VCASpec()
     :   slug("VCA"),
@@ -91,6 +91,106 @@ TEST_CASE( "VCA", "[VCA]" ) {
             REQUIRE( test_vcaModule->getNumLights() == static_cast<int>(spec.get()->NUM_LIGHTS) );
             delete test_vcaModule;
         }
+        SECTION( "gain from the first sample" ) {
+            using VCAModule = ::StoneyDSP::StoneyVCV::VCA::VCAModule;
+
+            // Freshly constructed, at the knob's default of 100%, with no
+            // fade-in from silence while the control rate catches up
+            VCAModule test_vcaModule;
+            ::rack::engine::Module::ProcessArgs args;
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].setVoltage(5.0F);
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].channels = 1;
+            test_vcaModule.outputs[VCAModule::VCA_OUTPUT].channels = 1;
+            for (auto type : {::rack::engine::Port::INPUT, ::rack::engine::Port::OUTPUT}) {
+                ::rack::engine::Module::PortChangeEvent e;
+                e.connecting = true;
+                e.type = type;
+                e.portId = (type == ::rack::engine::Port::INPUT) ? VCAModule::VCA_INPUT : VCAModule::VCA_OUTPUT;
+                test_vcaModule.onPortChange(e);
+            }
+            test_vcaModule.process(args);
+            REQUIRE_THAT( test_vcaModule.outputs[VCAModule::VCA_OUTPUT].getVoltage(), Catch::Matchers::WithinAbs(5.0F, 1.0e-5F) );
+
+            // Likewise after a reset, from wherever the knob was left
+            test_vcaModule.params[VCAModule::GAIN_PARAM].setValue(0.0F);
+            for (int i = 0; i < 100; i++)
+                test_vcaModule.process(args);
+            test_vcaModule.onReset(::rack::engine::Module::ResetEvent());
+            test_vcaModule.process(args);
+            REQUIRE_THAT(
+                test_vcaModule.outputs[VCAModule::VCA_OUTPUT].getVoltage(),
+                Catch::Matchers::WithinAbs(0.5F * test_vcaModule.params[VCAModule::GAIN_PARAM].getValue(), 1.0e-5F)
+            );
+        }
+        SECTION( "cv ramped over the control-rate division" ) {
+            using VCAModule = ::StoneyDSP::StoneyVCV::VCA::VCAModule;
+
+            VCAModule test_vcaModule;
+            ::rack::engine::Module::ProcessArgs args;
+            auto &output = test_vcaModule.outputs[VCAModule::VCA_OUTPUT];
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].setVoltage(1.0F);
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].channels = 1;
+            test_vcaModule.inputs[VCAModule::CV_INPUT].setVoltage(0.0F);
+            test_vcaModule.inputs[VCAModule::CV_INPUT].channels = 1;
+            output.channels = 1;
+            for (int portId : {VCAModule::VCA_INPUT, VCAModule::CV_INPUT}) {
+                ::rack::engine::Module::PortChangeEvent e;
+                e.connecting = true;
+                e.type = ::rack::engine::Port::INPUT;
+                e.portId = portId;
+                test_vcaModule.onPortChange(e);
+            }
+            const ::StoneyDSP::uint32_t division = test_vcaModule.getControlRateDivision();
+            for (::StoneyDSP::uint32_t i = 0U; i < 4U * division; i++)
+                test_vcaModule.process(args);
+            REQUIRE( output.getVoltage() == 0.0F );
+
+            // A step in the cv is read at the control rate, then spread over
+            // one division rather than applied at once
+            test_vcaModule.inputs[VCAModule::CV_INPUT].setVoltage(10.0F);
+            float previous = output.getVoltage();
+            for (::StoneyDSP::uint32_t i = 0U; i < 3U * division; i++) {
+                test_vcaModule.process(args);
+                REQUIRE( output.getVoltage() >= previous );
+                REQUIRE( output.getVoltage() - previous <= 1.0F / static_cast<float>(division) + 1.0e-5F );
+                previous = output.getVoltage();
+            }
+            REQUIRE_THAT( output.getVoltage(), Catch::Matchers::WithinAbs(1.0F, 1.0e-5F) );
+        }
+        SECTION( "voiceLights" ) {
+            using VCAModule = ::StoneyDSP::StoneyVCV::VCA::VCAModule;
+
+            VCAModule test_vcaModule;
+            ::rack::engine::Module::ProcessArgs args;
+            args.sampleRate = 1000.0F;
+            args.sampleTime = 1.0F / 1000.0F;
+            test_vcaModule.onSampleRateChange({args.sampleRate, args.sampleTime});
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].setVoltage(5.0F);
+            test_vcaModule.inputs[VCAModule::VCA_INPUT].channels = 1;
+            test_vcaModule.outputs[VCAModule::VCA_OUTPUT].channels = 1;
+            for (auto type : {::rack::engine::Port::INPUT, ::rack::engine::Port::OUTPUT}) {
+                ::rack::engine::Module::PortChangeEvent e;
+                e.connecting = true;
+                e.type = type;
+                e.portId = (type == ::rack::engine::Port::INPUT) ? VCAModule::VCA_INPUT : VCAModule::VCA_OUTPUT;
+                test_vcaModule.onPortChange(e);
+            }
+
+            auto &voiceLight = test_vcaModule.lights[VCAModule::VOICE_LIGHTS];
+            test_vcaModule.setVoiceLights(true);
+            for (int i = 0; i < 1000; i++)
+                test_vcaModule.process(args);
+            REQUIRE( voiceLight.getBrightness() > 0.0F );
+
+            // Hiding the lights only asks for them to be cleared; the engine
+            // does it, on its next pass over the lights
+            test_vcaModule.setVoiceLights(false);
+            REQUIRE( test_vcaModule.getVoiceLights() == false );
+            REQUIRE( voiceLight.getBrightness() > 0.0F );
+            for (int i = 0; i < 100; i++)
+                test_vcaModule.process(args);
+            REQUIRE( voiceLight.getBrightness() == 0.0F );
+        }
     }
 
     //==========================================================================
@@ -125,6 +225,148 @@ TEST_CASE( "VCA", "[VCA]" ) {
 
     //==========================================================================
 
+    SECTION( "VCAEngine" ) {
+        SECTION( "response curves" ) {
+            using Response = ::StoneyDSP::StoneyVCV::VCA::Response;
+            using Engine = ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float>;
+
+            // Every curve spans 0..1
+            for (auto response : {Response::Linear, Response::Exponential, Response::Logarithmic}) {
+                REQUIRE_THAT( Engine::applyResponse(0.0F, response), Catch::Matchers::WithinAbs(0.0F, 1.0e-6F) );
+                REQUIRE_THAT( Engine::applyResponse(1.0F, response), Catch::Matchers::WithinAbs(1.0F, 1.0e-6F) );
+            }
+
+            // Exponential is linear in decibels; halfway is -30dB
+            REQUIRE_THAT( Engine::applyResponse(0.5F, Response::Exponential), Catch::Matchers::WithinRel(31.0F / 1023.0F, 1.0e-5F) );
+            REQUIRE_THAT( Engine::applyResponse(0.5F, Response::Logarithmic), Catch::Matchers::WithinRel(0.9001406F, 1.0e-5F) );
+            REQUIRE( Engine::applyResponse(0.5F, Response::Linear) == 0.5F );
+
+            // Only the shaped curves are clamped; Linear still boosts
+            REQUIRE( Engine::applyResponse(1.2F, Response::Linear) == 1.2F );
+            REQUIRE_THAT( Engine::applyResponse(1.2F, Response::Exponential), Catch::Matchers::WithinAbs(1.0F, 1.0e-6F) );
+            REQUIRE_THAT( Engine::applyResponse(1.2F, Response::Logarithmic), Catch::Matchers::WithinAbs(1.0F, 1.0e-6F) );
+
+            // The vectorized curves match the scalar ones
+            const ::StoneyDSP::SIMD::float_4 levels {0.0F, 0.25F, 0.5F, 0.75F};
+            const auto exponential = ::StoneyDSP::StoneyVCV::VCA::VCAEngine<::StoneyDSP::SIMD::float_4>::applyResponse(levels, Response::Exponential);
+            for (int i = 0; i < 4; i++) {
+                REQUIRE( exponential[i] == Engine::applyResponse(levels[i], Response::Exponential) );
+            }
+
+            // `setGain()` applies the selected curve
+            Engine engine;
+            engine.setResponse(Response::Exponential);
+            engine.setGain(0.5F);
+            REQUIRE( engine.getGain() == Engine::applyResponse(0.5F, Response::Exponential) );
+        }
+        SECTION( "gain ramp" ) {
+            ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float> engine;
+            float buffer[2] = {1.0F, 1.0F};
+
+            engine.processSamples(buffer, buffer, 2U, 1.0F);
+            REQUIRE( buffer[0] == 0.5F );
+            REQUIRE( buffer[1] == 1.0F );
+
+            // Only the last gain set before a block counts, and the ramp
+            // starts from where the previous block ended
+            buffer[0] = buffer[1] = 1.0F;
+            engine.setGain(0.0F);
+            engine.setGain(0.5F);
+            REQUIRE( engine.getLastGain() == 1.0F );
+            engine.processSamples(buffer, 2U);
+            REQUIRE( buffer[0] == 0.75F );
+            REQUIRE( buffer[1] == 0.5F );
+            REQUIRE( engine.getLastGain() == 0.5F );
+        }
+    }
+
+    //==========================================================================
+
+    SECTION( "Kernels" ) {
+        using InstructionSet = ::StoneyDSP::StoneyVCV::Kernels::InstructionSet;
+        namespace Kernels = ::StoneyDSP::StoneyVCV::Kernels;
+
+        // The baseline leaves the bank to its own vector_type code
+        REQUIRE( Kernels::get(InstructionSet::Baseline).vcaGain == nullptr );
+
+        // Every wide kernel the host CPU runs advances all 16 gains by their
+        // steps, and applies them to the active channels
+        for (auto instructionSet : {InstructionSet::AVX, InstructionSet::AVX2}) {
+            if (!Kernels::isSupported(instructionSet))
+                continue;
+            INFO( Kernels::getName(instructionSet) );
+            const auto vcaGain = Kernels::get(instructionSet).vcaGain;
+            REQUIRE( vcaGain != nullptr );
+
+            const ::std::size_t numChannels = 11U;
+            ::StoneyDSP::SIMD::PolyBuffer<float> input, output(-1.0F), gain, step, expectedGain;
+            for (::std::size_t channel = 0U; channel < 16U; channel++) {
+                input[channel] = static_cast<float>(channel) - 5.0F;
+                gain[channel] = static_cast<float>(channel % 7U) / 6.0F;
+                step[channel] = (0.5F - gain[channel]) / 16.0F;
+            }
+            expectedGain = gain;
+            for (int i = 0; i < 16; i++) {
+                vcaGain(input.data(), output.data(), gain.data(), step.data(), numChannels);
+                for (::std::size_t channel = 0U; channel < 16U; channel++)
+                    expectedGain[channel] += step[channel];
+            }
+            for (::std::size_t channel = 0U; channel < 16U; channel++) {
+                REQUIRE_THAT( gain[channel], Catch::Matchers::WithinAbs(expectedGain[channel], 1.0e-6F) );
+                REQUIRE_THAT( gain[channel], Catch::Matchers::WithinAbs(0.5F, 1.0e-5F) );
+            }
+            for (::std::size_t channel = 0U; channel < numChannels; channel++)
+                REQUIRE_THAT( output[channel], Catch::Matchers::WithinAbs(input[channel] * gain[channel], 1.0e-5F) );
+
+            // In place, as with the VCA's output-only voltages
+            vcaGain(input.data(), input.data(), gain.data(), step.data(), numChannels);
+            REQUIRE_THAT( input[9U], Catch::Matchers::WithinAbs(4.0F * (0.5F + step[9U]), 1.0e-5F) );
+        }
+    }
+
+    //==========================================================================
+
+    SECTION( "PeakMeter" ) {
+        ::StoneyDSP::StoneyVCV::PeakMeter<::StoneyDSP::SIMD::float_4> meter;
+
+        // Only the first 6 of 8 channels are active
+        meter.process(::StoneyDSP::SIMD::float_4 {0.1F, 0.2F, 0.3F, 0.4F}, 0U, 6U);
+        meter.process(::StoneyDSP::SIMD::float_4 {0.5F, 0.6F, 0.9F, 0.9F}, 4U, 6U);
+        meter.process(::StoneyDSP::SIMD::float_4 {0.2F, 0.7F, 0.0F, 0.0F}, 4U, 6U);
+        REQUIRE( meter.flush() == 0.7F );
+
+        // Each block starts afresh
+        meter.process(::StoneyDSP::SIMD::float_4 {0.25F, 0.9F, 0.9F, 0.9F}, 0U, 1U);
+        REQUIRE( meter.flush() == 0.25F );
+        REQUIRE( meter.flush() == 0.0F );
+    }
+
+    //==========================================================================
+
+    SECTION( "VoiceMeter" ) {
+        ::StoneyDSP::StoneyVCV::VoiceMeter<::StoneyDSP::SIMD::float_4> meter;
+        ::rack::engine::Light lights[16];
+        ::StoneyDSP::SIMD::PolyBuffer<float> levels(0.5F);
+
+        // Active voices light at once, inactive ones stay dark
+        meter.process(levels, 6U, 0.01F, lights);
+        for (::std::size_t voice = 0U; voice < 16U; ++voice)
+            REQUIRE( lights[voice].getBrightness() == (voice < 6U ? 0.5F : 0.0F) );
+
+        // Falling levels fade out at the rate of `setBrightnessSmooth()`
+        ::rack::engine::Light light;
+        light.setBrightness(0.5F);
+        light.setBrightnessSmooth(0.0F, 0.01F);
+        levels.fill(0.0F);
+        meter.process(levels, 6U, 0.01F, lights);
+        REQUIRE_THAT( lights[0].getBrightness(), Catch::Matchers::WithinAbs(light.getBrightness(), 1e-6F) );
+
+        meter.reset(lights);
+        REQUIRE( lights[0].getBrightness() == 0.0F );
+    }
+
+    //==========================================================================
+
     SECTION( "createModelVCA" ) {
 
         ::rack::plugin::Model* test_modelVCA = ::StoneyDSP::StoneyVCV::VCA::createModelVCA();
@@ -0,0 +1,585 @@
+/*******************************************************************************
+ * @file test/StoneyVCV/benchmarks.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Micro-benchmarks for the engines, the SIMD maths and the modules.
+ * @version 2.0.2
+ * @date 2024-11-11
+ *
+ * @copyright MIT License
+ *
+ * Copyright (c) 2024 Nathan J. Hood <nathanjhood@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#include <StoneyVCV.hpp>
+#include <StoneyVCV/Kernels.hpp>
+
+#if defined (STONEYVCV_BUILD_VCA)
+ #include <StoneyVCV/VCA.hpp>
+#endif
+
+#if defined (STONEYVCV_EXPERIMENTAL) && defined (STONEYVCV_BUILD_LFO)
+ #include <StoneyVCV/LFO.hpp>
+#endif
+
+//==============================================================================
+
+#include <rack.hpp>
+#include <StoneyDSP/DSP.hpp>
+#include <StoneyDSP/SIMD.hpp>
+
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+
+//==============================================================================
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//==============================================================================
+
+namespace StoneyDSP {
+
+//==============================================================================
+
+namespace StoneyVCV {
+
+//==============================================================================
+
+namespace Benchmarks {
+
+//==============================================================================
+
+/**
+ * @brief The sample rate that the voices per core are reported at.
+ *
+ */
+static constexpr double sampleRate = 48000.0;
+
+/**
+ * @brief The number of input values cycled through by each benchmark, so that
+ * no run can be folded into a constant. A power of two.
+ *
+ */
+static constexpr int signalSize = 64;
+
+//==============================================================================
+
+/**
+ * @brief The number of voices processed by one run of each named benchmark.
+ *
+ */
+static ::std::map<::std::string, ::std::size_t>& getVoices()
+{
+    static ::std::map<::std::string, ::std::size_t> voices;
+    return voices;
+}
+
+/**
+ * @brief Records that one run of the benchmark `name` processes one sample
+ * of `numVoices` voices, and returns `name`.
+ *
+ * @param name
+ * @param numVoices
+ * @return std::string
+ */
+static ::std::string voices(const ::std::string &name, ::std::size_t numVoices)
+{
+    ::StoneyDSP::StoneyVCV::Benchmarks::getVoices()[name] = numVoices;
+    return name;
+}
+
+/**
+ * @brief Returns `signalSize` values of a sine in `[-1, 1]`, as `T`.
+ *
+ * @tparam T
+ * @return std::vector<T>
+ */
+template <typename T>
+static ::std::vector<T> makeSignal()
+{
+    ::std::vector<T> signal;
+    signal.reserve(static_cast<::std::size_t>(signalSize));
+    for (int i = 0; i < signalSize; i++) {
+        const double x = ::std::sin(2.0 * 3.14159265358979323846 * static_cast<double>(i) / static_cast<double>(signalSize));
+        signal.push_back(static_cast<T>(static_cast<float>(x)));
+    }
+    return signal;
+}
+
+/**
+ * @brief Returns `signalSize` phases, evenly spaced across `[0, 1)`, as `T`.
+ *
+ * @tparam T
+ * @return std::vector<T>
+ */
+template <typename T>
+static ::std::vector<T> makePhases()
+{
+    ::std::vector<T> phases;
+    phases.reserve(static_cast<::std::size_t>(signalSize));
+    for (int i = 0; i < signalSize; i++) {
+        phases.push_back(static_cast<T>(static_cast<float>(i) / static_cast<float>(signalSize)));
+    }
+    return phases;
+}
+
+//==============================================================================
+
+/**
+ * @brief Collects the mean of each benchmark, and prints them as ns/sample
+ * and voices per core once the run has ended.
+ *
+ */
+struct BenchmarkListener : ::Catch::EventListenerBase
+{
+    using ::Catch::EventListenerBase::EventListenerBase;
+
+    void benchmarkEnded(::Catch::BenchmarkStats<> const &stats) override
+    {
+        this->results.emplace_back(stats.info.name, stats.mean.point.count());
+    }
+
+    void testRunEnded(::Catch::TestRunStats const &) override
+    {
+        if (this->results.empty())
+            return;
+
+        // One sample period, in nanoseconds
+        const double budget = 1.0e9 / ::StoneyDSP::StoneyVCV::Benchmarks::sampleRate;
+
+        ::std::printf("\n%-60s %12s %8s %16s\n", "benchmark", "ns/sample", "voices", "voices/core@48k");
+        for (const auto &result : this->results) {
+            const auto it = ::StoneyDSP::StoneyVCV::Benchmarks::getVoices().find(result.first);
+            const ::std::size_t numVoices = it != ::StoneyDSP::StoneyVCV::Benchmarks::getVoices().end() ? it->second : 1U;
+            const double nsPerSample = result.second;
+            const double voicesPerCore = nsPerSample > 0.0 ? static_cast<double>(numVoices) * budget / nsPerSample : 0.0;
+            ::std::printf("%-60s %12.3f %8zu %16.0f\n", result.first.c_str(), nsPerSample, numVoices, voicesPerCore);
+        }
+        ::std::printf("\n");
+    }
+
+    ::std::vector<::std::pair<::std::string, double>> results;
+};
+
+CATCH_REGISTER_LISTENER(BenchmarkListener)
+
+//==============================================================================
+
+} // namespace Benchmarks
+
+//==============================================================================
+
+} // namespace StoneyVCV
+
+//==============================================================================
+
+} // namespace StoneyDSP
+
+//==============================================================================
+
+TEST_CASE( "SIMD", "[SIMD][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+    using ::StoneyDSP::SIMD::float_4;
+
+    const ::std::vector<float_4> signal = makeSignal<float_4>();
+    const float_4 gain(0.5F);
+    const float_4 lo(-0.5F), hi(0.5F);
+
+    BENCHMARK_ADVANCED((voices("SIMD::float_4 operator*", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return signal[i & (signalSize - 1)] * gain; });
+    };
+
+    BENCHMARK_ADVANCED((voices("SIMD::float_4 operator* operator+", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return signal[i & (signalSize - 1)] * gain + hi; });
+    };
+
+    BENCHMARK_ADVANCED((voices("SIMD::clamp(float_4)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::SIMD::clamp(signal[i & (signalSize - 1)], lo, hi); });
+    };
+
+    BENCHMARK_ADVANCED((voices("SIMD::ifelse(float_4)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            const float_4 x = signal[i & (signalSize - 1)];
+            return ::StoneyDSP::SIMD::ifelse(x < lo, lo, x);
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("SIMD::exp2(float_4)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::SIMD::exp2(signal[i & (signalSize - 1)]); });
+    };
+
+    BENCHMARK_ADVANCED((voices("SIMD::sinFolded(foldPhase(float_4))", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::SIMD::sinFolded(::StoneyDSP::SIMD::foldPhase(signal[i & (signalSize - 1)])); });
+    };
+}
+
+//==============================================================================
+
+TEST_CASE( "Oscillator", "[LFO][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+    using ::StoneyDSP::SIMD::float_4;
+
+    // Each waveform is timed on its own, from a precomputed block of phases,
+    // rather than behind the phase accumulator. The phase increment is a
+    // 1kHz oscillator's, wide enough that some phases fall within the
+    // PolyBLEP corrections
+    const ::std::vector<float> phases = makePhases<float>();
+    const ::std::vector<float_4> phases4 = makePhases<float_4>();
+    const float dt = static_cast<float>(1000.0 / sampleRate);
+    const float_4 dt4(dt);
+    const float width = 0.5F;
+    const float_4 width4(width);
+
+    ::StoneyDSP::DSP::Oscillator<float> osc;
+    osc.freq = 1.0F;
+    ::StoneyDSP::DSP::Oscillator<float_4> osc4;
+    osc4.freq = float_4(1.0F);
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float>::sin()", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc.setPhase(phases[i & (signalSize - 1)], dt);
+            return osc.sin();
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float>::saw()", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc.setPhase(phases[i & (signalSize - 1)], dt);
+            return osc.saw();
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float>::pulse()", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc.setPhase(phases[i & (signalSize - 1)], dt);
+            return osc.pulse(width);
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("DSP::polyBlepSaw(float)", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::DSP::polyBlepSaw(phases[i & (signalSize - 1)], dt); });
+    };
+
+    BENCHMARK_ADVANCED((voices("DSP::polyBlepPulse(float)", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::DSP::polyBlepPulse(phases[i & (signalSize - 1)], dt, width); });
+    };
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float_4>::sin()", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc4.setPhase(phases4[i & (signalSize - 1)], dt4);
+            return osc4.sin();
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float_4>::saw()", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc4.setPhase(phases4[i & (signalSize - 1)], dt4);
+            return osc4.saw();
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("Oscillator<float_4>::pulse()", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            osc4.setPhase(phases4[i & (signalSize - 1)], dt4);
+            return osc4.pulse(width4);
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("DSP::polyBlepSaw(float_4)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::DSP::polyBlepSaw(phases4[i & (signalSize - 1)], dt4); });
+    };
+
+    BENCHMARK_ADVANCED((voices("DSP::polyBlepPulse(float_4)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return ::StoneyDSP::DSP::polyBlepPulse(phases4[i & (signalSize - 1)], dt4, width4); });
+    };
+}
+
+//==============================================================================
+
+#if defined (STONEYVCV_BUILD_VCA)
+
+TEST_CASE( "VCAEngine", "[VCA][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+
+    ::StoneyDSP::StoneyVCV::VCA::VCAEngine<float> engine;
+    engine.setGain(0.5F);
+
+    const ::std::vector<float> signal = makeSignal<float>();
+    const ::std::vector<::StoneyDSP::SIMD::float_4> signal4 = makeSignal<::StoneyDSP::SIMD::float_4>();
+    const ::std::vector<::StoneyDSP::SIMD::double_2> signal2 = makeSignal<::StoneyDSP::SIMD::double_2>();
+
+    BENCHMARK_ADVANCED((voices("VCAEngine<float>::processSample(float*)", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            float v = signal[i & (signalSize - 1)];
+            engine.processSample(&v);
+            return v;
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("VCAEngine<float>::processSampleSimd(float_4*)", 4U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            ::StoneyDSP::SIMD::float_4 v = signal4[i & (signalSize - 1)];
+            engine.processSampleSimd(&v);
+            return v;
+        });
+    };
+
+    BENCHMARK_ADVANCED((voices("VCAEngine<float>::processSampleSimd(double_2*)", 2U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            ::StoneyDSP::SIMD::double_2 v = signal2[i & (signalSize - 1)];
+            engine.processSampleSimd(&v);
+            return v;
+        });
+    };
+
+#if STONEYDSP_USING_AVX
+    const ::std::vector<::StoneyDSP::SIMD::float_8> signal8 = makeSignal<::StoneyDSP::SIMD::float_8>();
+
+    BENCHMARK_ADVANCED((voices("VCAEngine<float>::processSampleSimd(float_8*)", 8U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            ::StoneyDSP::SIMD::float_8 v = signal8[i & (signalSize - 1)];
+            engine.processSampleSimd(&v);
+            return v;
+        });
+    };
+#endif
+}
+
+TEST_CASE( "VCAModule", "[VCA][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+    using ::StoneyDSP::StoneyVCV::VCA::VCAModule;
+
+    // As the plugin's init() does, before the modules are created
+    ::StoneyDSP::StoneyVCV::Kernels::select();
+
+    const ::std::vector<float> signal = makeSignal<float>();
+
+    for (int numChannels : { 1, 4, 8, 16 }) {
+        VCAModule module;
+
+        ::rack::engine::Module::SampleRateChangeEvent eSampleRateChange;
+        eSampleRateChange.sampleRate = static_cast<float>(sampleRate);
+        eSampleRateChange.sampleTime = static_cast<float>(1.0 / sampleRate);
+        module.onSampleRateChange(eSampleRateChange);
+
+        // Patch the ports, as the engine would when cables are connected
+        for (int inputId : { VCAModule::VCA_INPUT, VCAModule::CV_INPUT }) {
+            module.inputs[inputId].channels = static_cast<::std::uint8_t>(numChannels);
+            ::rack::engine::Module::PortChangeEvent ePortChange;
+            ePortChange.connecting = true;
+            ePortChange.type = ::rack::engine::Port::INPUT;
+            ePortChange.portId = inputId;
+            module.onPortChange(ePortChange);
+        }
+        module.outputs[VCAModule::VCA_OUTPUT].channels = 1U;
+        ::rack::engine::Module::PortChangeEvent ePortChange;
+        ePortChange.connecting = true;
+        ePortChange.type = ::rack::engine::Port::OUTPUT;
+        ePortChange.portId = VCAModule::VCA_OUTPUT;
+        module.onPortChange(ePortChange);
+
+        ::rack::engine::Module::ProcessArgs args;
+        args.sampleRate = static_cast<float>(sampleRate);
+        args.sampleTime = static_cast<float>(1.0 / sampleRate);
+        args.frame = 0;
+
+        // Fill the inputs once, rather than as part of each measured sample;
+        // each channel gets its own voltages
+        for (int c = 0; c < numChannels; c++) {
+            const float x = signal[(c * 5) & (signalSize - 1)];
+            module.inputs[VCAModule::VCA_INPUT].voltages[c] = 5.0F * x;
+            module.inputs[VCAModule::CV_INPUT].voltages[c] = 5.0F + 5.0F * x;
+        }
+
+        BENCHMARK_ADVANCED((voices("VCAModule::process (" + ::std::to_string(numChannels) + (numChannels == 1 ? " channel)" : " channels)"), static_cast<::std::size_t>(numChannels))))(::Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                module.process(args);
+                args.frame++;
+                return module.outputs[VCAModule::VCA_OUTPUT].voltages[0];
+            });
+        };
+    }
+}
+
+#endif
+
+//==============================================================================
+
+#if defined (STONEYVCV_EXPERIMENTAL) && defined (STONEYVCV_BUILD_LFO)
+
+TEST_CASE( "LFOEngine", "[LFO][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+
+    ::StoneyDSP::StoneyVCV::LFO::LFOEngine<float> engine;
+    engine.setSampleTime(static_cast<float>(1.0 / sampleRate));
+    engine.setFrequency(2.0F);
+
+    ::StoneyDSP::StoneyVCV::LFO::LFOEngine<::StoneyDSP::SIMD::float_4> engine4;
+    engine4.setSampleTime(::StoneyDSP::SIMD::float_4(static_cast<float>(1.0 / sampleRate)));
+    engine4.setFrequency(::StoneyDSP::SIMD::float_4(2.0F));
+
+    // The waveforms share one phase and are derived together, so the phase
+    // alone is measured against all four rather than each in isolation. The
+    // names are parenthesised for the commas in the calls to voices()
+    BENCHMARK((voices("LFOEngine<float>::processSample(phase)", 1U)))
+    {
+        float v = 0.0F;
+        engine.processSample(&v);
+        return v;
+    };
+
+    BENCHMARK((voices("LFOEngine<float>::processSample(sin, tri, saw, sqr)", 1U)))
+    {
+        float sin = 0.0F, tri = 0.0F, saw = 0.0F, sqr = 0.0F;
+        engine.processSample(&sin, &tri, &saw, &sqr);
+        return sin + tri + saw + sqr;
+    };
+
+    const ::std::vector<float> signal = makeSignal<float>();
+
+    BENCHMARK_ADVANCED((voices("LFOEngine<float>::processSample(phase, sin, tri, saw, sqr)", 1U)))(::Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) {
+            const float p = 0.5F + 0.499F * signal[i & (signalSize - 1)];
+            float sin = 0.0F, tri = 0.0F, saw = 0.0F, sqr = 0.0F;
+            engine.processSample(p, &sin, &tri, &saw, &sqr);
+            return sin + tri + saw + sqr;
+        });
+    };
+
+    BENCHMARK((voices("LFOEngine<float_4>::processSample(phase)", 4U)))
+    {
+        ::StoneyDSP::SIMD::float_4 v(0.0F);
+        engine4.processSample(&v);
+        return v;
+    };
+
+    BENCHMARK((voices("LFOEngine<float_4>::processSample(sin, tri, saw, sqr)", 4U)))
+    {
+        ::StoneyDSP::SIMD::float_4 sin(0.0F), tri(0.0F), saw(0.0F), sqr(0.0F);
+        engine4.processSample(&sin, &tri, &saw, &sqr);
+        return sin + tri + saw + sqr;
+    };
+}
+
+TEST_CASE( "LFOModule", "[LFO][benchmark]" )
+{
+    using namespace ::StoneyDSP::StoneyVCV::Benchmarks;
+    using ::StoneyDSP::StoneyVCV::LFO::LFOModule;
+
+    // As the plugin's init() does, before the modules are created
+    ::StoneyDSP::StoneyVCV::Kernels::select();
+
+    const ::std::vector<float> signal = makeSignal<float>();
+
+    for (int numChannels : { 1, 4, 8, 16 }) {
+        LFOModule module;
+
+        ::rack::engine::Module::SampleRateChangeEvent eSampleRateChange;
+        eSampleRateChange.sampleRate = static_cast<float>(sampleRate);
+        eSampleRateChange.sampleTime = static_cast<float>(1.0 / sampleRate);
+        module.onSampleRateChange(eSampleRateChange);
+
+        // Patch the ports, as the engine would when cables are connected; the
+        // modulation inputs set the channel count, and every waveform is
+        // read
+        for (int inputId : { LFOModule::FM_INPUT, LFOModule::PWM_INPUT }) {
+            module.inputs[inputId].channels = static_cast<::std::uint8_t>(numChannels);
+            ::rack::engine::Module::PortChangeEvent ePortChange;
+            ePortChange.connecting = true;
+            ePortChange.type = ::rack::engine::Port::INPUT;
+            ePortChange.portId = inputId;
+            module.onPortChange(ePortChange);
+        }
+        for (int outputId : { LFOModule::SIN_OUTPUT, LFOModule::TRI_OUTPUT, LFOModule::SAW_OUTPUT, LFOModule::SQR_OUTPUT }) {
+            module.outputs[outputId].channels = static_cast<::std::uint8_t>(numChannels);
+            ::rack::engine::Module::PortChangeEvent ePortChange;
+            ePortChange.connecting = true;
+            ePortChange.type = ::rack::engine::Port::OUTPUT;
+            ePortChange.portId = outputId;
+            module.onPortChange(ePortChange);
+        }
+
+        // Fill the inputs once, rather than as part of each measured sample;
+        // each channel gets its own voltages
+        for (int c = 0; c < numChannels; c++) {
+            const float x = signal[(c * 5) & (signalSize - 1)];
+            module.inputs[LFOModule::FM_INPUT].voltages[c] = x;
+            module.inputs[LFOModule::PWM_INPUT].voltages[c] = 2.5F * x;
+        }
+
+        ::rack::engine::Module::ProcessArgs args;
+        args.sampleRate = static_cast<float>(sampleRate);
+        args.sampleTime = static_cast<float>(1.0 / sampleRate);
+        args.frame = 0;
+
+        BENCHMARK_ADVANCED((voices("LFOModule::process (" + ::std::to_string(numChannels) + (numChannels == 1 ? " channel)" : " channels)"), static_cast<::std::size_t>(numChannels))))(::Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                module.process(args);
+                args.frame++;
+                return module.outputs[LFOModule::SIN_OUTPUT].voltages[0];
+            });
+        };
+    }
+}
+
+#endif
+
+//==============================================================================
@@ -0,0 +1,778 @@
+/*******************************************************************************
+ * @file test/StoneyVCV/render.cpp
+ * @author Nathan J. Hood <nathanjhood@googlemail.com>
+ * @brief Renders a module offline, without a window or an audio device.
+ * @version 2.0.2
+ * @date 2024-11-11
+ *
+ * @copyright MIT License
+ *
+ * Copyright (c) 2024 Nathan J. Hood <nathanjhood@googlemail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ ******************************************************************************/
+
+//==============================================================================
+
+#include <StoneyVCV.hpp>
+#include <StoneyVCV/Kernels.hpp>
+
+#if defined (STONEYVCV_BUILD_VCA)
+ #include <StoneyVCV/VCA.hpp>
+#endif
+
+#if defined (STONEYVCV_EXPERIMENTAL) && defined (STONEYVCV_BUILD_LFO)
+ #include <StoneyVCV/LFO.hpp>
+#endif
+
+//==============================================================================
+
+#include <rack.hpp>
+
+//==============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+//==============================================================================
+
+namespace StoneyDSP {
+
+//==============================================================================
+
+namespace StoneyVCV {
+
+//==============================================================================
+
+namespace Render {
+
+//==============================================================================
+
+/**
+ * @brief The number of frames generated, processed and written at a time.
+ *
+ */
+static constexpr ::std::size_t blockSize = 4096U;
+
+/**
+ * @brief The number of values per frame of a block; one per channel.
+ *
+ */
+static constexpr ::std::size_t frameSize = static_cast<::std::size_t>(::rack::engine::PORT_MAX_CHANNELS);
+
+//==============================================================================
+
+static void printUsage(::std::FILE *stream)
+{
+    ::std::fprintf(stream,
+        "usage: render <module> [options]\n"
+        "\n"
+        "Runs a module's process() offline, and writes its outputs to files.\n"
+        "\n"
+        "  <module>                     VCA, or LFO when built with STONEYVCV_EXPERIMENTAL\n"
+        "\n"
+        "options:\n"
+        "  -r, --sample-rate <hz>       the engine sample rate (default: 48000)\n"
+        "  -c, --channels <n>           the channels of each patched input, 1..16 (default: 1)\n"
+        "  -n, --samples <n>            the number of samples to render (default: 480000)\n"
+        "  -i, --input <id>=<source>    patches an input to a source\n"
+        "  -o, --output <id>[=<file>]   patches an output, and writes it to a file;\n"
+        "                               '.wav' for 32-bit float WAV, else raw 32-bit float.\n"
+        "                               If none are given, every output is patched and discarded\n"
+        "  -p, --param <id>=<value>     sets a param\n"
+        "  -d, --data <json>            passed to dataFromJson(), e.g. '{\"response\": 1}'\n"
+        "  -e, --expect-peak <v>        fails unless every patched output is finite, and peaks\n"
+        "                               at <v> volts or more; e.g. as a smoke test\n"
+        "  -l, --list                   lists the module's params and ports, then exits\n"
+        "  -h, --help                   shows this message, then exits\n"
+        "\n"
+        "sources (volts; channel c of n starts c/n of a cycle late):\n"
+        "  dc:<v>                       a constant\n"
+        "  sine:<hz>[:<v>]              a sine of peak <v> (default: 5)\n"
+        "  saw:<hz>[:<v>]               a rising saw of peak <v> (default: 5)\n"
+        "  square:<hz>[:<v>]            a square of peak <v> (default: 5)\n"
+        "  noise[:<v>]                  uniform white noise of peak <v> (default: 5)\n"
+        "  file:<path>                  raw 32-bit float, interleaved by channel, looped\n"
+        "\n"
+        "Inputs, outputs and params are numbered as listed by --list.\n"
+    );
+}
+
+//==============================================================================
+
+/**
+ * @brief Constructs the module named `slug`, or returns `nullptr` if it is
+ * unknown or wasn't built.
+ *
+ * @param slug
+ */
+static ::std::unique_ptr<::rack::engine::Module> createModule(const ::std::string &slug)
+{
+#if defined (STONEYVCV_BUILD_VCA)
+    if (slug == "VCA")
+        return ::std::unique_ptr<::rack::engine::Module>(new ::StoneyDSP::StoneyVCV::VCA::VCAModule);
+#endif
+#if defined (STONEYVCV_EXPERIMENTAL) && defined (STONEYVCV_BUILD_LFO)
+    if (slug == "LFO")
+        return ::std::unique_ptr<::rack::engine::Module>(new ::StoneyDSP::StoneyVCV::LFO::LFOModule);
+#endif
+    return nullptr;
+}
+
+//==============================================================================
+
+/**
+ * @brief Parses all of `text` as a number.
+ *
+ * @param text
+ * @param value Set on success.
+ * @return `false` if `text` is empty or isn't a number.
+ */
+static bool parseNumber(const ::std::string &text, double &value)
+{
+    if (text.empty())
+        return false;
+    char *end = nullptr;
+    value = ::std::strtod(text.c_str(), &end);
+    return end == text.c_str() + text.size();
+}
+
+/**
+ * @brief Splits `text` at its first `=` into an id and a value.
+ *
+ * @param text
+ * @param id Set on success.
+ * @param value Set on success; empty if there is no `=`.
+ * @return `false` if the id isn't a non-negative integer.
+ */
+static bool parseAssignment(const ::std::string &text, int &id, ::std::string &value)
+{
+    const auto equals = text.find('=');
+    double number = 0.0;
+    if (!::StoneyDSP::StoneyVCV::Render::parseNumber(text.substr(0U, equals), number) || number < 0.0 || number != ::std::floor(number))
+        return false;
+    id = static_cast<int>(number);
+    value = (equals == ::std::string::npos) ? ::std::string() : text.substr(equals + 1U);
+    return true;
+}
+
+//==============================================================================
+
+/**
+ * @brief The `Source` struct. Generates the voltages of one patched input.
+ *
+ */
+struct Source
+{
+    enum class Kind {
+        DC,
+        Sine,
+        Saw,
+        Square,
+        Noise,
+        File
+    };
+
+    Kind kind = Kind::DC;
+
+    float frequency = 0.0F;
+
+    float amplitude = 5.0F;
+
+    /** The samples of a `File` source, interleaved by channel. */
+    ::std::vector<float> samples;
+
+    ::std::size_t position = 0U;
+
+    /** The state of the `Noise` source's generator. */
+    ::std::uint32_t seed = 0x9E3779B9U;
+
+    /** The phase of each channel, in cycles. */
+    double phase[::StoneyDSP::StoneyVCV::Render::frameSize] = {};
+
+    /**
+     * @brief Parses a source, as described by `printUsage()`.
+     *
+     * @param text
+     * @param numChannels
+     * @param error Set on failure.
+     * @return `false` on failure.
+     */
+    bool parse(const ::std::string &text, ::std::size_t numChannels, ::std::string &error)
+    {
+        ::std::vector<::std::string> fields;
+        ::std::size_t begin = 0U;
+        for (::std::size_t colon = text.find(':'); ; colon = text.find(':', begin)) {
+            fields.push_back(text.substr(begin, colon - begin));
+            if (colon == ::std::string::npos)
+                break;
+            begin = colon + 1U;
+        }
+
+        const ::std::string &name = fields[0];
+        double number = 0.0;
+
+        if (name == "file") {
+            this->kind = Kind::File;
+            const ::std::string path = text.substr(5U);
+            ::std::FILE *file = ::std::fopen(path.c_str(), "rb");
+            if (file == nullptr) {
+                error = "cannot open '" + path + "'";
+                return false;
+            }
+            float buffer[1024];
+            ::std::size_t count = 0U;
+            while ((count = ::std::fread(buffer, sizeof(float), 1024U, file)) > 0U)
+                this->samples.insert(this->samples.end(), buffer, buffer + count);
+            ::std::fclose(file);
+            if (this->samples.size() < numChannels) {
+                error = "'" + path + "' holds less than one frame";
+                return false;
+            }
+            // Drop any partial frame, so that the loop stays in step
+            this->samples.resize(this->samples.size() - (this->samples.size() % numChannels));
+            return true;
+        }
+
+        if (name == "dc") {
+            this->kind = Kind::DC;
+            if (fields.size() != 2U || !::StoneyDSP::StoneyVCV::Render::parseNumber(fields[1], number)) {
+                error = "expected dc:<v>";
+                return false;
+            }
+            this->amplitude = static_cast<float>(number);
+            return true;
+        }
+
+        if (name == "noise") {
+            this->kind = Kind::Noise;
+            if (fields.size() > 2U || (fields.size() == 2U && !::StoneyDSP::StoneyVCV::Render::parseNumber(fields[1], number))) {
+                error = "expected noise[:<v>]";
+                return false;
+            }
+            if (fields.size() == 2U)
+                this->amplitude = static_cast<float>(number);
+            return true;
+        }
+
+        if (name == "sine")
+            this->kind = Kind::Sine;
+        else if (name == "saw")
+            this->kind = Kind::Saw;
+        else if (name == "square")
+            this->kind = Kind::Square;
+        else {
+            error = "unknown source '" + name + "'";
+            return false;
+        }
+
+        if (fields.size() < 2U || fields.size() > 3U || !::StoneyDSP::StoneyVCV::Render::parseNumber(fields[1], number)) {
+            error = "expected " + name + ":<hz>[:<v>]";
+            return false;
+        }
+        this->frequency = static_cast<float>(number);
+        if (fields.size() == 3U) {
+            if (!::StoneyDSP::StoneyVCV::Render::parseNumber(fields[2], number)) {
+                error = "expected " + name + ":<hz>[:<v>]";
+                return false;
+            }
+            this->amplitude = static_cast<float>(number);
+        }
+
+        for (::std::size_t channel = 0U; channel < numChannels; ++channel)
+            this->phase[channel] = static_cast<double>(channel) / static_cast<double>(numChannels);
+        return true;
+    }
+
+    /**
+     * @brief Writes the next `numFrames` frames to `block`, `frameSize`
+     * values apart.
+     *
+     * @param block
+     * @param numFrames
+     * @param numChannels
+     * @param sampleTime
+     */
+    void generate(float *block, ::std::size_t numFrames, ::std::size_t numChannels, double sampleTime)
+    {
+        const double increment = static_cast<double>(this->frequency) * sampleTime;
+
+        for (::std::size_t frame = 0U; frame < numFrames; ++frame) {
+            float *voltages = block + (frame * ::StoneyDSP::StoneyVCV::Render::frameSize);
+
+            for (::std::size_t channel = 0U; channel < numChannels; ++channel) {
+                double &phase = this->phase[channel];
+
+                switch (this->kind) {
+                case Kind::DC:
+                    voltages[channel] = this->amplitude;
+                    break;
+                case Kind::Sine:
+                    voltages[channel] = this->amplitude * static_cast<float>(::std::sin(2.0 * M_PI * phase));
+                    break;
+                case Kind::Saw:
+                    voltages[channel] = this->amplitude * static_cast<float>((2.0 * phase) - 1.0);
+                    break;
+                case Kind::Square:
+                    voltages[channel] = (phase < 0.5) ? this->amplitude : -this->amplitude;
+                    break;
+                case Kind::Noise:
+                    // xorshift32
+                    this->seed ^= this->seed << 13;
+                    this->seed ^= this->seed >> 17;
+                    this->seed ^= this->seed << 5;
+                    voltages[channel] = this->amplitude * ((static_cast<float>(this->seed) * (2.0F / 4294967296.0F)) - 1.0F);
+                    break;
+                case Kind::File:
+                    voltages[channel] = this->samples[this->position++];
+                    break;
+                }
+
+                phase += increment;
+                phase -= ::std::floor(phase);
+            }
+
+            if (this->kind == Kind::File && this->position >= this->samples.size())
+                this->position = 0U;
+        }
+    }
+};
+
+//==============================================================================
+
+/**
+ * @brief The `Sink` struct. Writes the voltages of one patched output to a
+ * raw or WAV file, and keeps its peak.
+ *
+ */
+struct Sink
+{
+    ::std::string path;
+
+    ::std::FILE *file = nullptr;
+
+    bool wav = false;
+
+    /** The channels written per frame; fixed by the first block. */
+    ::std::size_t numChannels = 0U;
+
+    ::std::uint64_t numFrames = 0U;
+
+    float peak = 0.0F;
+
+    /** Cleared by the first NaN or infinite voltage, which `peak` skips. */
+    bool finite = true;
+
+    ::std::vector<float> interleaved;
+
+    ~Sink()
+    {
+        if (this->file != nullptr)
+            ::std::fclose(this->file);
+    }
+
+    /**
+     * @brief Opens `path` for writing; a WAV header is reserved, and filled
+     * in by `close()`.
+     *
+     * @return `false` on failure.
+     */
+    bool open()
+    {
+        if (this->path.empty())
+            return true;
+
+        this->file = ::std::fopen(this->path.c_str(), "wb");
+        if (this->file == nullptr)
+            return false;
+
+        const ::std::string extension = ".wav";
+        this->wav = this->path.size() >= extension.size()
+            && this->path.compare(this->path.size() - extension.size(), extension.size(), extension) == 0;
+        if (this->wav) {
+            const ::std::uint8_t header[44] = {};
+            ::std::fwrite(header, 1U, sizeof(header), this->file);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Appends `numBlockFrames` frames of `block`, `frameSize` values
+     * apart.
+     *
+     * @param block
+     * @param numBlockFrames
+     * @param outputChannels The output's current number of channels.
+     */
+    void write(const float *block, ::std::size_t numBlockFrames, ::std::size_t outputChannels)
+    {
+        if (this->numChannels == 0U)
+            this->numChannels = ::std::max<::std::size_t>(1U, outputChannels);
+
+        this->interleaved.resize(numBlockFrames * this->numChannels);
+        for (::std::size_t frame = 0U; frame < numBlockFrames; ++frame) {
+            for (::std::size_t channel = 0U; channel < this->numChannels; ++channel) {
+                const float voltage = block[(frame * ::StoneyDSP::StoneyVCV::Render::frameSize) + channel];
+                this->interleaved[(frame * this->numChannels) + channel] = voltage;
+                this->peak = ::std::max(this->peak, ::std::fabs(voltage));
+                this->finite = this->finite && ::std::isfinite(voltage);
+            }
+        }
+        this->numFrames += numBlockFrames;
+
+        if (this->file != nullptr)
+            ::std::fwrite(this->interleaved.data(), sizeof(float), this->interleaved.size(), this->file);
+    }
+
+    /**
+     * @brief Fills in the WAV header, if any, and closes the file.
+     *
+     * @param sampleRate
+     */
+    void close(float sampleRate)
+    {
+        if (this->file == nullptr)
+            return;
+
+        if (this->wav) {
+            const ::std::uint32_t channels = static_cast<::std::uint32_t>(this->numChannels);
+            const ::std::uint32_t rate = static_cast<::std::uint32_t>(sampleRate);
+            const ::std::uint32_t blockAlign = channels * 4U;
+            const ::std::uint64_t dataSize = this->numFrames * blockAlign;
+            const ::std::uint32_t clampedDataSize = static_cast<::std::uint32_t>(::std::min<::std::uint64_t>(dataSize, 0xFFFFFFFFU - 36U));
+
+            ::std::uint8_t header[44];
+            ::std::uint8_t *p = header;
+            auto chars = [&p](const char *s) { ::std::memcpy(p, s, 4U); p += 4; };
+            auto u16 = [&p](::std::uint32_t v) { *p++ = static_cast<::std::uint8_t>(v); *p++ = static_cast<::std::uint8_t>(v >> 8); };
+            auto u32 = [&p](::std::uint32_t v) { for (int i = 0; i < 32; i += 8) *p++ = static_cast<::std::uint8_t>(v >> i); };
+
+            chars("RIFF");
+            u32(36U + clampedDataSize);
+            chars("WAVE");
+            chars("fmt ");
+            u32(16U);
+            u16(3U);                // WAVE_FORMAT_IEEE_FLOAT
+            u16(channels);
+            u32(rate);
+            u32(rate * blockAlign);
+            u16(blockAlign);
+            u16(32U);
+            chars("data");
+            u32(clampedDataSize);
+
+            ::std::fseek(this->file, 0, SEEK_SET);
+            ::std::fwrite(header, 1U, sizeof(header), this->file);
+        }
+
+        ::std::fclose(this->file);
+        this->file = nullptr;
+    }
+};
+
+//==============================================================================
+
+} // namespace Render
+
+//==============================================================================
+
+} // namespace StoneyVCV
+
+//==============================================================================
+
+} // namespace StoneyDSP
+
+//==============================================================================
+
+int main(int argc, char **argv)
+{
+    namespace Render = ::StoneyDSP::StoneyVCV::Render;
+
+    if (argc < 2) {
+        Render::printUsage(stderr);
+        return EXIT_FAILURE;
+    }
+
+    const ::std::string slug = argv[1];
+    if (slug == "-h" || slug == "--help") {
+        Render::printUsage(stdout);
+        return EXIT_SUCCESS;
+    }
+
+    // As the plugin's init() does, before the module's engines are created
+    ::StoneyDSP::StoneyVCV::Kernels::select();
+
+    ::std::unique_ptr<::rack::engine::Module> module = Render::createModule(slug);
+    if (!module) {
+        ::std::fprintf(stderr, "render: unknown module '%s'\n", slug.c_str());
+        return EXIT_FAILURE;
+    }
+
+    double sampleRate = 48000.0;
+    double numChannels = 1.0;
+    double numSamples = 480000.0;
+    ::std::vector<::std::pair<int, ::std::string>> inputArgs, outputArgs, paramArgs;
+    ::std::string data;
+    double expectedPeak = -1.0;
+    bool list = false;
+
+    for (int arg = 2; arg < argc; ++arg) {
+        const ::std::string option = argv[arg];
+        auto next = [&]() -> const char * {
+            return (arg + 1 < argc) ? argv[++arg] : nullptr;
+        };
+
+        if (option == "-h" || option == "--help") {
+            Render::printUsage(stdout);
+            return EXIT_SUCCESS;
+        }
+        if (option == "-l" || option == "--list") {
+            list = true;
+            continue;
+        }
+
+        const char *value = next();
+        if (value == nullptr) {
+            ::std::fprintf(stderr, "render: '%s' expects a value\n", option.c_str());
+            return EXIT_FAILURE;
+        }
+
+        bool valid = true;
+        if (option == "-r" || option == "--sample-rate")
+            valid = Render::parseNumber(value, sampleRate) && sampleRate > 0.0;
+        else if (option == "-c" || option == "--channels")
+            valid = Render::parseNumber(value, numChannels) && numChannels >= 1.0 && numChannels <= static_cast<double>(Render::frameSize) && numChannels == ::std::floor(numChannels);
+        else if (option == "-n" || option == "--samples")
+            valid = Render::parseNumber(value, numSamples) && numSamples >= 0.0 && numSamples == ::std::floor(numSamples);
+        else if (option == "-d" || option == "--data")
+            data = value;
+        else if (option == "-e" || option == "--expect-peak")
+            valid = Render::parseNumber(value, expectedPeak) && expectedPeak >= 0.0;
+        else if (option == "-i" || option == "--input" || option == "-o" || option == "--output" || option == "-p" || option == "--param") {
+            int id = 0;
+            ::std::string assigned;
+            valid = Render::parseAssignment(value, id, assigned);
+            if (option == "-i" || option == "--input")
+                inputArgs.emplace_back(id, assigned);
+            else if (option == "-o" || option == "--output")
+                outputArgs.emplace_back(id, assigned);
+            else
+                paramArgs.emplace_back(id, assigned);
+        }
+        else {
+            ::std::fprintf(stderr, "render: unknown option '%s'\n", option.c_str());
+            return EXIT_FAILURE;
+        }
+
+        if (!valid) {
+            ::std::fprintf(stderr, "render: invalid value '%s' for '%s'\n", value, option.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (list) {
+        for (int id = 0; id < module->getNumParams(); ++id) {
+            const auto *quantity = module->paramQuantities[id];
+            ::std::printf("param %d: %s (%g..%g, default %g)\n", id,
+                quantity ? quantity->name.c_str() : "",
+                quantity ? quantity->minValue : 0.0F,
+                quantity ? quantity->maxValue : 0.0F,
+                quantity ? quantity->defaultValue : 0.0F
+            );
+        }
+        for (int id = 0; id < module->getNumInputs(); ++id)
+            ::std::printf("input %d: %s\n", id, module->inputInfos[id] ? module->inputInfos[id]->name.c_str() : "");
+        for (int id = 0; id < module->getNumOutputs(); ++id)
+            ::std::printf("output %d: %s\n", id, module->outputInfos[id] ? module->outputInfos[id]->name.c_str() : "");
+        return EXIT_SUCCESS;
+    }
+
+    const ::std::size_t channels = static_cast<::std::size_t>(numChannels);
+
+    // Settings first, as a module may rebuild its coefficients from them
+    if (!data.empty()) {
+        ::json_error_t error;
+        ::json_t *rootJ = ::json_loads(data.c_str(), 0, &error);
+        if (rootJ == nullptr) {
+            ::std::fprintf(stderr, "render: invalid --data: %s\n", error.text);
+            return EXIT_FAILURE;
+        }
+        module->dataFromJson(rootJ);
+        ::json_decref(rootJ);
+    }
+
+    for (const auto &param : paramArgs) {
+        double value = 0.0;
+        if (param.first >= module->getNumParams() || !Render::parseNumber(param.second, value)) {
+            ::std::fprintf(stderr, "render: invalid param %d='%s'\n", param.first, param.second.c_str());
+            return EXIT_FAILURE;
+        }
+        module->params[param.first].setValue(static_cast<float>(value));
+    }
+
+    ::rack::engine::Module::SampleRateChangeEvent eSampleRateChange;
+    eSampleRateChange.sampleRate = static_cast<float>(sampleRate);
+    eSampleRateChange.sampleTime = static_cast<float>(1.0 / sampleRate);
+    module->onSampleRateChange(eSampleRateChange);
+
+    // Patch the ports, as the engine would when cables are connected
+    ::std::vector<int> inputIds;
+    ::std::vector<Render::Source> sources(static_cast<::std::size_t>(module->getNumInputs()));
+    for (const auto &input : inputArgs) {
+        ::std::string error;
+        if (input.first >= module->getNumInputs()) {
+            ::std::fprintf(stderr, "render: no input %d\n", input.first);
+            return EXIT_FAILURE;
+        }
+        if (!sources[static_cast<::std::size_t>(input.first)].parse(input.second, channels, error)) {
+            ::std::fprintf(stderr, "render: input %d: %s\n", input.first, error.c_str());
+            return EXIT_FAILURE;
+        }
+        inputIds.push_back(input.first);
+        // Set directly; `setChannels()` ignores a disconnected port
+        module->inputs[input.first].channels = static_cast<::std::uint8_t>(channels);
+
+        ::rack::engine::Module::PortChangeEvent ePortChange;
+        ePortChange.connecting = true;
+        ePortChange.type = ::rack::engine::Port::INPUT;
+        ePortChange.portId = input.first;
+        module->onPortChange(ePortChange);
+    }
+
+    if (outputArgs.empty()) {
+        for (int id = 0; id < module->getNumOutputs(); ++id)
+            outputArgs.emplace_back(id, ::std::string());
+    }
+
+    ::std::vector<int> outputIds;
+    ::std::vector<Render::Sink> sinks(outputArgs.size());
+    for (::std::size_t index = 0U; index < outputArgs.size(); ++index) {
+        const auto &output = outputArgs[index];
+        if (output.first >= module->getNumOutputs()) {
+            ::std::fprintf(stderr, "render: no output %d\n", output.first);
+            return EXIT_FAILURE;
+        }
+        sinks[index].path = output.second;
+        if (!sinks[index].open()) {
+            ::std::fprintf(stderr, "render: cannot open '%s'\n", output.second.c_str());
+            return EXIT_FAILURE;
+        }
+        outputIds.push_back(output.first);
+        module->outputs[output.first].channels = 1U;
+
+        ::rack::engine::Module::PortChangeEvent ePortChange;
+        ePortChange.connecting = true;
+        ePortChange.type = ::rack::engine::Port::OUTPUT;
+        ePortChange.portId = output.first;
+        module->onPortChange(ePortChange);
+    }
+
+    // Render, timing only the calls into the module
+    ::std::vector<float> inputBlocks(inputIds.size() * Render::blockSize * Render::frameSize);
+    ::std::vector<float> outputBlocks(outputIds.size() * Render::blockSize * Render::frameSize);
+
+    ::rack::engine::Module::ProcessArgs args;
+    args.sampleRate = static_cast<float>(sampleRate);
+    args.sampleTime = static_cast<float>(1.0 / sampleRate);
+    args.frame = 0;
+
+    const ::std::uint64_t totalFrames = static_cast<::std::uint64_t>(numSamples);
+    ::std::chrono::steady_clock::duration elapsed {};
+
+    for (::std::uint64_t done = 0U; done < totalFrames; ) {
+        const ::std::size_t numFrames = static_cast<::std::size_t>(::std::min<::std::uint64_t>(Render::blockSize, totalFrames - done));
+
+        for (::std::size_t i = 0U; i < inputIds.size(); ++i)
+            sources[static_cast<::std::size_t>(inputIds[i])].generate(&inputBlocks[i * Render::blockSize * Render::frameSize], numFrames, channels, 1.0 / sampleRate);
+
+        const auto start = ::std::chrono::steady_clock::now();
+        for (::std::size_t frame = 0U; frame < numFrames; ++frame) {
+            for (::std::size_t i = 0U; i < inputIds.size(); ++i)
+                ::std::memcpy(module->inputs[inputIds[i]].getVoltages(), &inputBlocks[((i * Render::blockSize) + frame) * Render::frameSize], channels * sizeof(float));
+
+            module->process(args);
+            ++args.frame;
+
+            for (::std::size_t i = 0U; i < outputIds.size(); ++i)
+                ::std::memcpy(&outputBlocks[((i * Render::blockSize) + frame) * Render::frameSize], module->outputs[outputIds[i]].getVoltages(), Render::frameSize * sizeof(float));
+        }
+        elapsed += ::std::chrono::steady_clock::now() - start;
+
+        for (::std::size_t i = 0U; i < outputIds.size(); ++i)
+            sinks[i].write(&outputBlocks[i * Render::blockSize * Render::frameSize], numFrames, static_cast<::std::size_t>(module->outputs[outputIds[i]].getChannels()));
+
+        done += numFrames;
+    }
+
+    for (auto &sink : sinks)
+        sink.close(static_cast<float>(sampleRate));
+
+    // Report
+    const double seconds = ::std::chrono::duration<double>(elapsed).count();
+    const double renderedSeconds = static_cast<double>(totalFrames) / sampleRate;
+    ::std::printf("%s: %llu samples x %zu channels at %g Hz (%s)\n",
+        slug.c_str(),
+        static_cast<unsigned long long>(totalFrames),
+        channels,
+        sampleRate,
+        ::StoneyDSP::StoneyVCV::Kernels::getName(::StoneyDSP::StoneyVCV::Kernels::get().instructionSet)
+    );
+    ::std::printf("  %.3f s, %.2f ns/sample, %.1fx real time\n",
+        seconds,
+        totalFrames > 0U ? (seconds * 1.0e9) / static_cast<double>(totalFrames) : 0.0,
+        seconds > 0.0 ? renderedSeconds / seconds : 0.0
+    );
+    for (::std::size_t i = 0U; i < outputIds.size(); ++i) {
+        ::std::printf("  output %d: %zu channels, peak %.6g V%s%s\n",
+            outputIds[i],
+            sinks[i].numChannels,
+            static_cast<double>(sinks[i].peak),
+            sinks[i].path.empty() ? "" : " -> ",
+            sinks[i].path.c_str()
+        );
+    }
+
+    // Checked once every output has been reported
+    int result = EXIT_SUCCESS;
+    if (expectedPeak >= 0.0) {
+        for (::std::size_t i = 0U; i < outputIds.size(); ++i) {
+            if (!sinks[i].finite) {
+                ::std::fprintf(stderr, "render: output %d is not finite\n", outputIds[i]);
+                result = EXIT_FAILURE;
+            } else if (static_cast<double>(sinks[i].peak) < expectedPeak) {
+                ::std::fprintf(stderr, "render: output %d peaks at %.6g V, below the expected %.6g V\n",
+                    outputIds[i],
+                    static_cast<double>(sinks[i].peak),
+                    expectedPeak
+                );
+                result = EXIT_FAILURE;
+            }
+        }
+    }
+
+    return result;
+}